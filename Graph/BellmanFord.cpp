@@ -1,26 +1,24 @@
 #include <vector>
+#include <climits>
 #include <iostream>
 #include <iomanip>
-#include <unordered_set>
-#include <unordered_map>
+#include "Graph.h"
 
-struct edge {
-    double weight;
-    int from, to;
-    edge(int p_from, int p_to, double p_weight) : from(p_from), to(p_to), weight(p_weight) {}
-    edge(int p_from, int p_to) : from(p_from), to(p_to), weight(0) {}
-};
-
-std::unordered_map<int, std::vector<std::pair<int, double>>> adj_list; // adjacency list
+CSRGraph<int, double> graph; // graph in compressed sparse row format
 std::vector<int> dist; // tracks distances from source vrertex to every other vertex 
 
 // searches for all vertices connected to a vertex which is part of a negative cycle
-void dfs(std::vector<bool>& vis, int curr) {
-    if (vis[curr]) return;
-    vis[curr] = true;
-    dist[curr] = INT_MIN;
-    for (auto& [next, weight] : adj_list[curr])
-        dfs(vis, next);
+// note: uses explicit stack so long chains can't overflow the call stack
+void dfs(std::vector<bool>& vis, int start) {
+    std::vector<int> stack = {start};
+    while (!stack.empty()) {
+        int curr = stack.back(); stack.pop_back();
+        if (vis[curr]) continue;
+        vis[curr] = true;
+        dist[curr] = INT_MIN;
+        for (auto [next, weight] : graph.neighbors(curr))
+            if (!vis[next]) stack.push_back(next);
+    }
 }
 
 /* Bellman ford algorithm - time complexity O(EV): 
@@ -35,20 +33,25 @@ void dfs(std::vector<bool>& vis, int curr) {
 // algo 1) implements Bellman Ford, returns all vertices that are part of negative cycles
 std::vector<bool> negativeCycleVertices(const std::vector<edge>& edges, int n, int src = 0) {
     // initializes distances from src vertex to every other vertex
-    dist.resize(n, INT_MAX);
+    dist.assign(n, INT_MAX);
     dist[src] = 0;
-   // iterates through and relaxes all edges, repeats |V| - 1 times
+    // iterates through and relaxes all edges, repeats |V| - 1 times
+    // stops early once a pass leaves every distance unchanged
     for (int i = 0; i < n - 1; i++) {
+        bool changed = false;
         for (const auto& e : edges) {
-            if (e.from == INT_MAX) continue;
-            if (dist[e.from] + e.weight < dist[e.to])
+            if (dist[e.from] == INT_MAX) continue;
+            if (dist[e.from] + e.weight < dist[e.to]) {
                 dist[e.to] = dist[e.from] + e.weight;
+                changed = true;
+            }
         }
+        if (!changed) break;
     }
     // detects negative cycle if any edge weight can be relaxed during |V|th iteration
     std::vector<bool> cycle(n, false);
     for (const auto& e : edges) {
-        if (e.from == INT_MAX) continue;
+        if (dist[e.from] == INT_MAX) continue;
         // if negative cycle detected, dfs on "bad" vertices
         if (dist[e.from] + e.weight < dist[e.to])
             dfs(cycle, e.to);
@@ -62,16 +65,21 @@ bool detectNegativeCycle(const std::vector<edge>& edges, int n, int src = 0) {
     std::vector<int> dist(n, INT_MAX);
     dist[src] = 0;
     // iterates through and relaxes all edges, repeats |V| - 1 times
+    // stops early once a pass leaves every distance unchanged
     for (int i = 0; i < n - 1; i++) {
+        bool changed = false;
         for (const auto& e : edges) {
-            if (e.from == INT_MAX) continue;
-            if (dist[e.from] + e.weight < dist[e.to])
+            if (dist[e.from] == INT_MAX) continue;
+            if (dist[e.from] + e.weight < dist[e.to]) {
                 dist[e.to] = dist[e.from] + e.weight;
+                changed = true;
+            }
         }
+        if (!changed) break;
     }
     // detects negative cycle if any edge weight can be relaxed during |V|th iteration
     for (const auto& e : edges) {
-        if (e.from == INT_MAX) continue;
+        if (dist[e.from] == INT_MAX) continue;
         // if negative cycle detected, return true
         if (dist[e.from] + e.weight < dist[e.to])
             return true;
@@ -82,10 +90,9 @@ bool detectNegativeCycle(const std::vector<edge>& edges, int n, int src = 0) {
 // sample test case for bellman ford algorithm
 int main() {
     int src = 0, n = 8;
-    // represents graph using edge set and adjacency list
+    // represents graph using edge set and compressed sparse row adjacency
     std::vector<edge> edges = {{0, 1, 2}, {0, 4, 3}, {0, 5, 6}, {1, 2, 1}, {2, 3, 4}, {3, 1, -7}, {4, 5, 1}, {5, 7, 2}, {6, 7, -2}};
-    for (const auto& e: edges)
-        adj_list[e.from].push_back({e.to, e.weight});
+    graph = CSRGraph<int, double>(edges, n);
     // run bellman ford algorithm on graph
     std::vector<bool> neg_cycle_label = negativeCycleVertices(edges, n, src);
     std::vector<int> neg_cycle_vertices;
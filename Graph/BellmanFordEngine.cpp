@@ -0,0 +1,50 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "BellmanFordEngine.h"
+
+typedef CSRGraph<int, long long> graph_t;
+typedef BellmanFordEngine<graph_t> engine_t;
+
+void benchmark(const std::string& name, const graph_t& graph) {
+    engine_t engine(graph);
+    std::cout << '\n' << name << " (n = " << graph.vertexCount() << ", m = " << graph.edgeCount() << ")\n" << std::left
+              << std::setw(12) << "mode" << std::setw(14) << "time (ms)" << std::setw(10) << "passes" << std::setw(16) << "relaxations"
+              << std::setw(16) << "neg. cycle" << "checksum" << '\n';
+    std::pair<engine_t::Mode, std::string> modes[] = {{engine_t::PASSES, "passes"}, {engine_t::SPFA, "spfa"}, {engine_t::PARALLEL, "parallel"}};
+    for (auto& [mode, mode_name] : modes) {
+        auto start = std::chrono::steady_clock::now();
+        engine_t::Result r = engine.run(0, mode);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        long long checksum = 0;
+        for (long long d : r.dist) if (d != engine_t::INF) checksum += d;
+        std::cout << std::setw(12) << mode_name << std::setw(14) << ms << std::setw(10) << r.passes << std::setw(16) << r.relaxations
+                  << std::setw(16) << (r.negative_cycle ? "yes" : "no") << (r.negative_cycle ? 0 : checksum) << '\n';
+    }
+}
+
+// sample test case & benchmark comparing bellman ford modes
+int main() {
+    int src = 0, n = 8;
+    std::vector<edge> edges = {{0, 1, 2}, {0, 4, 3}, {0, 5, 6}, {1, 2, 1}, {2, 3, 4}, {3, 1, 7}, {4, 5, 1}, {5, 7, 2}, {6, 7, -2}};
+    graph_t graph(edges, n);
+    engine_t::Result r = engine_t(graph).run(src);
+    std::cout << std::left << std::setw(10) << "Vertex" << std::setw(10) << "Dist. from src" << '\n';
+    for (int i = 0; i < n; i++) {
+        if (i == src) continue;
+        std::string cost = r.dist[i] == engine_t::INF ? "+INF" : std::to_string(r.dist[i]);
+        std::cout << std::setw(10) << i << std::setw(10) << cost << '\n';
+    }
+
+    const int big = 200000;
+    std::vector<edge> random = erdosRenyiGraph(big, 8 * big, 42);
+    benchmark("non-negative weights", graph_t(random, big));
+    benchmark("negative weights, no negative cycle", graph_t(reweightByPotential(random, randomPotentials(big, 7, 60)), big));
+    const int small = 5000;
+    std::vector<edge> cyclic = reweightByPotential(erdosRenyiGraph(small, 8 * small, 42), randomPotentials(small, 7, 60));
+    cyclic.push_back({0, 1, -1000000});
+    cyclic.push_back({1, 0, -1000000});
+    benchmark("negative cycle", graph_t(cyclic, small));
+    return 0;
+}
@@ -0,0 +1,162 @@
+#pragma once
+#include <deque>
+#include <limits>
+#include <vector>
+#include <type_traits>
+#include "Graph.h"
+
+// adds edge weight to a finite distance without wrapping around for integer distance types
+template <typename W>
+W saturatingAdd(W a, W b) {
+    if constexpr (std::is_integral<W>::value) {
+        W sum;
+        if (__builtin_add_overflow(a, b, &sum)) return b < 0 ? std::numeric_limits<W>::min() : std::numeric_limits<W>::max();
+        return sum;
+    } else
+        return a + b;
+}
+
+/* bellman ford engine - single source shortest paths with negative edge weights, time complexity O(EV) worst case
+//   - PASSES: relaxes every edge each pass, stops early once a pass changes nothing
+//   - SPFA: fifo worklist, only rescans out-edges of vertices whose distance changed
+//   - PARALLEL: each pass relaxes out-edges of vertices changed in the previous pass across threads using atomic min
+//   - detects negative cycles reachable from source: a pass still changes distances after |V| - 1 passes (PASSES,
+//     PARALLEL), or a shortest path reaches |V| edges (SPFA)
+//   - unreached vertices keep distance INF & are never used to relax edges, so INF is never added to a weight
+// @template
+//   - G: graph type providing vertexCount() & neighbors(v) (e.g. CSRGraph), W may be an integer or floating type
+*/
+template <typename G>
+class BellmanFordEngine {
+    public:
+        typedef typename G::vertex_type V;
+        typedef typename G::weight_type W;
+
+        enum Mode { PASSES, SPFA, PARALLEL };
+
+        static constexpr W INF = std::numeric_limits<W>::max();
+
+        struct Result {
+            std::vector<W> dist;
+            std::vector<V> bp; // back pointers (may be inconsistent when a negative cycle was found)
+            bool negative_cycle = false;
+            std::size_t passes = 0; // full passes (PASSES, PARALLEL) or vertex scans / |V| (SPFA)
+            std::size_t relaxations = 0; // successful distance updates
+        };
+
+    private:
+        const G* graph;
+        std::size_t n;
+        unsigned threads;
+
+        void runPasses(V src, Result& r) const {
+            r.dist[src] = 0;
+            bool changed = true;
+            while (changed && r.passes < n) {
+                changed = false;
+                r.passes++;
+                for (std::size_t u = 0; u < n; u++) {
+                    if (r.dist[u] == INF) continue;
+                    for (auto [next, weight] : graph->neighbors(u)) {
+                        W d = saturatingAdd(r.dist[u], weight);
+                        if (d < r.dist[next]) {
+                            r.dist[next] = d;
+                            r.bp[next] = u;
+                            r.relaxations++;
+                            changed = true;
+                        }
+                    }
+                }
+            }
+            r.negative_cycle = changed;
+        }
+
+        void runSPFA(V src, Result& r) const {
+            std::vector<std::size_t> length(n, 0); // # of edges on current shortest path
+            std::vector<bool> queued(n, false);
+            std::deque<V> queue = {src};
+            std::size_t scans = 0;
+            r.dist[src] = 0;
+            queued[src] = true;
+            while (!queue.empty()) {
+                V u = queue.front(); queue.pop_front();
+                queued[u] = false;
+                scans++;
+                for (auto [next, weight] : graph->neighbors(u)) {
+                    W d = saturatingAdd(r.dist[u], weight);
+                    if (d >= r.dist[next]) continue;
+                    r.dist[next] = d;
+                    r.bp[next] = u;
+                    r.relaxations++;
+                    length[next] = length[u] + 1;
+                    if (length[next] >= n) {
+                        r.negative_cycle = true;
+                        r.passes = (scans + n - 1) / n;
+                        return;
+                    }
+                    if (!queued[next]) {
+                        queued[next] = true;
+                        queue.push_back(next);
+                    }
+                }
+            }
+            r.passes = (scans + n - 1) / n;
+        }
+
+        void runParallel(V src, Result& r) const {
+            std::vector<std::atomic<W>> dist(n);
+            for (auto& d : dist) d.store(INF, std::memory_order_relaxed);
+            dist[src].store(0, std::memory_order_relaxed);
+            std::vector<V> active = {src};
+            std::vector<std::atomic<bool>> next_active(n);
+            for (auto& a : next_active) a.store(false, std::memory_order_relaxed);
+            std::vector<std::size_t> relaxations(threads, 0);
+            while (!active.empty() && r.passes < n) {
+                r.passes++;
+                parallelFor(0, active.size(), [&](unsigned t, std::size_t lo, std::size_t hi) {
+                    for (std::size_t i = lo; i < hi; i++) {
+                        V u = active[i];
+                        W du = dist[u].load(std::memory_order_relaxed);
+                        for (auto [next, weight] : graph->neighbors(u)) {
+                            if (!atomicMin(dist[next], saturatingAdd(du, weight))) continue;
+                            relaxations[t]++;
+                            next_active[next].store(true, std::memory_order_relaxed);
+                        }
+                    }
+                }, threads, 1 << 10);
+                active.clear();
+                for (std::size_t v = 0; v < n; v++)
+                    if (next_active[v].exchange(false, std::memory_order_relaxed)) active.push_back(v);
+            }
+            r.negative_cycle = !active.empty();
+            for (std::size_t t = 0; t < threads; t++) r.relaxations += relaxations[t];
+            for (std::size_t v = 0; v < n; v++) r.dist[v] = dist[v].load(std::memory_order_relaxed);
+            /* recovers back pointers by a bfs from src over tight edges (dist[u] + w == dist[v])
+            //   - the last winning relaxation of every reached vertex is a tight edge from its final parent, so bfs
+            //     reaches all of them, & since each vertex is claimed once from an already claimed vertex the back
+            //     pointers form a tree rooted at src even through zero weight cycles
+            */
+            std::vector<V> queue = {src};
+            for (std::size_t head = 0; head < queue.size(); head++) {
+                V u = queue[head];
+                for (auto [next, weight] : graph->neighbors(u)) {
+                    if (next == src || r.bp[next] != -1 || saturatingAdd(r.dist[u], weight) != r.dist[next]) continue;
+                    r.bp[next] = u;
+                    queue.push_back(next);
+                }
+            }
+        }
+
+    public:
+        BellmanFordEngine(const G& p_graph, unsigned p_threads = defaultThreads()) : graph(&p_graph), n(p_graph.vertexCount()), threads(p_threads) {}
+
+        Result run(V src, Mode mode = SPFA) const {
+            Result r;
+            r.dist.assign(n, INF);
+            r.bp.assign(n, -1);
+            if (mode == PASSES) runPasses(src, r);
+            else if (mode == SPFA) runSPFA(src, r);
+            else runParallel(src, r);
+            return r;
+        }
+};
@@ -0,0 +1,163 @@
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <iostream>
+#include <functional>
+#include <sys/resource.h>
+#include "Generators.h"
+#include "NegativeCycle.h"
+#include "DijkstraEngine.h"
+#include "BellmanFordEngine.h"
+#include "BlockedFloydWarshall.h"
+
+/* shortest path benchmark suite - times every algorithm over seeded graph families & sizes, emits one json record per run
+//   - dijkstra: DijkstraEngine on non-negative weights, mean over several sources
+//   - bellman-ford: BellmanFordEngine (SPFA) on the same graph reweighted by random potentials (negative edges,
+//     no negative cycle), distances are checked against dijkstra's through d'(s, t) = d(s, t) + p(s) - p(t)
+//   - negative-cycle: NegativeCycle over the whole graph after planting one negative cycle, must find it
+//   - floyd-warshall: BlockedFloydWarshall on the reweighted graph, only for small vertex counts
+// usage: Benchmark [--quick] [--label name] [output.json] - json goes to stdout when no file is given, progress to stderr
+// record fields: edges_per_sec counts scanned edges (dijkstra), relaxation attempts (bellman-ford, negative-cycle
+// estimate: scans x average degree) or V^3 inner updates (floyd-warshall); peak_rss_kb is the process high-water mark
+*/
+
+typedef CSRGraph<int, long long> graph_t;
+
+struct Record {
+    std::string family, algorithm;
+    std::size_t vertices, edges;
+    double ms, edges_per_sec;
+    std::size_t settled; // vertices settled / reached / scanned
+    long peak_rss_kb;
+    bool ok;
+};
+
+long peakRSS() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+double timeMs(const std::function<void()>& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string escape(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+void benchmark(const std::string& family, std::vector<edge> edges, int n, unsigned seed, std::vector<Record>& records) {
+    auto add = [&](const std::string& algorithm, std::size_t m, double ms, double work, std::size_t settled, bool ok) {
+        records.push_back({family, algorithm, (std::size_t) n, m, ms, ms > 0 ? work / ms * 1000 : 0, settled, peakRSS(), ok});
+        const Record& r = records.back();
+        std::cerr << std::left << std::setw(14) << family << std::setw(16) << algorithm << std::setw(10) << n << std::setw(11) << m
+                  << std::setw(12) << ms << std::setw(14) << r.edges_per_sec << std::setw(10) << settled << std::setw(12) << r.peak_rss_kb
+                  << (ok ? "" : "FAILED") << '\n';
+    };
+    graph_t graph(edges, n);
+    std::mt19937 rng(seed);
+    std::vector<int> sources(4);
+    for (auto& s : sources)
+        do s = rng() % n; while (graph.degree(s) == 0); // r-mat leaves many vertices isolated
+
+    // dijkstra's, non-negative weights
+    DijkstraEngine<graph_t> engine(graph);
+    std::size_t settled = 0, scanned = 0;
+    double ms = 0;
+    for (int s : sources) {
+        ms += timeMs([&]() { engine.run(s); });
+        settled += engine.settledCount();
+        for (std::size_t v = 0; v < graph.vertexCount(); v++)
+            if (engine.isSettled(v)) scanned += graph.degree(v);
+    }
+    std::vector<long long> reference(n);
+    for (int v = 0; v < n; v++) reference[v] = engine.distance(v);
+    add("dijkstra", graph.edgeCount(), ms / sources.size(), (double) scanned / sources.size(), settled / sources.size(), true);
+
+    // bellman ford, negative weights & no negative cycles; checked against the last dijkstra's source
+    std::vector<double> potential = randomPotentials(n, seed + 1, 100);
+    graph_t negative(reweightByPotential(edges, potential), n);
+    BellmanFordEngine<graph_t> bf(negative, 1);
+    BellmanFordEngine<graph_t>::Result result;
+    ms = timeMs([&]() { result = bf.run(sources.back(), BellmanFordEngine<graph_t>::SPFA); });
+    bool ok = !result.negative_cycle;
+    std::size_t reached = 0;
+    for (int v = 0; v < n; v++) {
+        if (result.dist[v] == BellmanFordEngine<graph_t>::INF) { ok = ok && reference[v] == DijkstraEngine<graph_t>::INF; continue; }
+        reached++;
+        ok = ok && result.dist[v] == reference[v] + (long long) (potential[sources.back()] - potential[v]);
+    }
+    double avg_degree = (double) graph.edgeCount() / n;
+    add("bellman-ford", negative.edgeCount(), ms, result.passes * (double) n * avg_degree, reached, ok);
+
+    // negative cycle detection from every vertex after planting a cycle
+    graph_t cyclic(plantNegativeCycle(reweightByPotential(edges, potential), n, 16, seed + 2), n);
+    std::size_t scans = 0;
+    ms = timeMs([&]() {
+        NegativeCycle<graph_t> cycle(cyclic);
+        ok = cycle.found;
+        scans = cycle.scans;
+    });
+    add("negative-cycle", cyclic.edgeCount(), ms, scans * avg_degree, scans, ok);
+
+    // floyd warshall, all pairs on negative weights (small graphs only)
+    if (n > 2048) return;
+    BlockedFloydWarshall fw(reweightByPotential(edges, potential), n);
+    ms = timeMs([&]() { fw.run(); });
+    ok = !fw.hasNegativeCycle();
+    for (int v = 0; v < n && ok; v++) {
+        long long expected = reference[v] == DijkstraEngine<graph_t>::INF ? INT_MAX : reference[v] + (long long) (potential[sources.back()] - potential[v]);
+        ok = fw.distance(sources.back(), v) == expected;
+    }
+    add("floyd-warshall", negative.edgeCount(), ms, (double) n * n * n, (std::size_t) n * n, ok);
+}
+
+int main(int argc, char** argv) {
+    bool quick = false;
+    std::string label = "local", out;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--quick") quick = true;
+        else if (arg == "--label" && i + 1 < argc) label = argv[++i];
+        else out = arg;
+    }
+    const unsigned seed = 42;
+    std::vector<int> scales = quick ? std::vector<int>{10, 14} : std::vector<int>{10, 14, 17, 20};
+
+    std::cerr << std::left << std::setw(14) << "family" << std::setw(16) << "algorithm" << std::setw(10) << "vertices" << std::setw(11) << "edges"
+              << std::setw(12) << "ms" << std::setw(14) << "edges / s" << std::setw(10) << "settled" << std::setw(12) << "rss (KB)" << '\n';
+    std::vector<Record> records;
+    for (int scale : scales) {
+        int n = 1 << scale, side = 1 << (scale / 2);
+        benchmark("grid", gridGraph(side, seed, 1, 100), side * side, seed, records);
+        benchmark("erdos-renyi", erdosRenyiGraph(n, 8ull * n, seed, 1, 100), n, seed, records);
+        benchmark("r-mat", rmatGraph(scale, 8ull * n, seed, 1, 100), n, seed, records);
+        benchmark("geometric", geometricGraph(n, 4, seed, 1000), n, seed, records);
+    }
+
+    std::ostringstream json;
+    json << std::setprecision(10) << "{\n  \"label\": \"" << escape(label) << "\",\n  \"seed\": " << seed
+         << ",\n  \"compiler\": \"" << escape(__VERSION__) << "\",\n  \"results\": [\n";
+    for (std::size_t i = 0; i < records.size(); i++) {
+        const Record& r = records[i];
+        json << "    {\"family\": \"" << r.family << "\", \"algorithm\": \"" << r.algorithm << "\", \"vertices\": " << r.vertices
+             << ", \"edges\": " << r.edges << ", \"ms\": " << r.ms << ", \"edges_per_sec\": " << r.edges_per_sec << ", \"settled\": "
+             << r.settled << ", \"peak_rss_kb\": " << r.peak_rss_kb << ", \"ok\": " << (r.ok ? "true" : "false") << "}"
+             << (i + 1 < records.size() ? "," : "") << '\n';
+    }
+    json << "  ]\n}\n";
+    if (out.empty()) std::cout << json.str();
+    else std::ofstream(out) << json.str();
+    bool all_ok = true;
+    for (const auto& r : records) all_ok = all_ok && r.ok;
+    return all_ok ? 0 : 1;
+}
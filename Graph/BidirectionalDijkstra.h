@@ -0,0 +1,120 @@
+#pragma once
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include "Graph.h"
+
+/* bidirectional dijkstra's - point to point shortest path
+//   - alternates a forward search from src over the graph & a backward search from dest over the reverse graph
+//   - mu tracks length of best src -> dest path found where the two searches meet
+//   - stopping criterion: once top of forward heap + top of backward heap >= mu, no shorter path can exist
+//   - reuses epoch stamped scratch arrays between queries like DijkstraEngine
+// @template
+//   - G: graph type providing vertexCount(), neighbors(v) & transpose() (e.g. CSRGraph)
+*/
+template <typename G>
+class BidirectionalDijkstra {
+    public:
+        typedef typename G::vertex_type V;
+        typedef typename G::weight_type W;
+
+        static constexpr W INF = std::numeric_limits<W>::max();
+
+    private:
+        typedef std::pair<W, V> entry;
+
+        // state of one search direction
+        struct Search {
+            const G* graph;
+            std::vector<W> dist;
+            std::vector<V> bp;
+            std::vector<std::uint32_t> reached, settled;
+            std::vector<entry> min_heap;
+
+            Search(const G& g) : graph(&g), dist(g.vertexCount()), bp(g.vertexCount()), reached(g.vertexCount(), 0), settled(g.vertexCount(), 0) {}
+
+            W topKey() const { return min_heap.empty() ? INF : min_heap.front().first; }
+
+            void relax(V v, W d, V prev, std::uint32_t epoch) {
+                if (reached[v] == epoch && d >= dist[v]) return;
+                reached[v] = epoch;
+                dist[v] = d;
+                bp[v] = prev;
+                min_heap.push_back({d, v});
+                std::push_heap(min_heap.begin(), min_heap.end(), std::greater<entry>());
+            }
+        };
+
+        G reverse_graph;
+        Search fwd, bwd;
+        std::uint32_t epoch;
+        std::size_t settled_count;
+        W mu; // length of best path found so far
+        V meet; // vertex where best path's forward & backward halves meet
+
+        // settles one vertex in search s, updating mu with paths through vertices already reached by other search
+        void step(Search& s, Search& other) {
+            std::pop_heap(s.min_heap.begin(), s.min_heap.end(), std::greater<entry>());
+            auto [d, curr] = s.min_heap.back(); s.min_heap.pop_back();
+            if (s.settled[curr] == epoch || d != s.dist[curr]) return;
+            s.settled[curr] = epoch;
+            settled_count++;
+            for (auto [next, weight] : s.graph->neighbors(curr)) {
+                s.relax(next, d + weight, curr, epoch);
+                if (other.reached[next] == epoch && s.dist[next] + other.dist[next] < mu) {
+                    mu = s.dist[next] + other.dist[next];
+                    meet = next;
+                }
+            }
+        }
+
+    public:
+        BidirectionalDijkstra(const G& graph)
+            : reverse_graph(graph.transpose()), fwd(graph), bwd(reverse_graph), epoch(0), settled_count(0), mu(INF), meet(-1) {}
+
+        // returns shortest distance from src to dest (INF if unreachable)
+        W query(V src, V dest) {
+            if (++epoch == 0) {
+                for (Search* s : {&fwd, &bwd}) {
+                    std::fill(s->reached.begin(), s->reached.end(), 0);
+                    std::fill(s->settled.begin(), s->settled.end(), 0);
+                }
+                epoch = 1;
+            }
+            fwd.min_heap.clear();
+            bwd.min_heap.clear();
+            settled_count = 0;
+            mu = src == dest ? 0 : INF;
+            meet = src == dest ? src : -1;
+            fwd.relax(src, 0, -1, epoch);
+            bwd.relax(dest, 0, -1, epoch);
+            while (!fwd.min_heap.empty() || !bwd.min_heap.empty()) {
+                W f = fwd.topKey(), b = bwd.topKey();
+                // lower bound on any path not yet discovered (an exhausted direction contributes nothing)
+                W lower = f == INF ? b : (b == INF ? f : f + b);
+                if (lower >= mu) break;
+                // expands direction with the smaller heap to balance work
+                if (b == INF || (f != INF && fwd.min_heap.size() <= bwd.min_heap.size()))
+                    step(fwd, bwd);
+                else
+                    step(bwd, fwd);
+            }
+            return mu;
+        }
+
+        std::size_t settledCount() const { return settled_count; }
+
+        // vertices along shortest path found by last query (empty if dest was unreachable)
+        std::vector<V> path() const {
+            std::vector<V> path;
+            if (meet == -1) return path;
+            for (V v = meet; v != -1; v = fwd.bp[v])
+                path.push_back(v);
+            std::reverse(path.begin(), path.end());
+            for (V v = bwd.bp[meet]; v != -1; v = bwd.bp[v])
+                path.push_back(v);
+            return path;
+        }
+};
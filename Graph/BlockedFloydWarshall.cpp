@@ -0,0 +1,90 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "BlockedFloydWarshall.h"
+
+// baseline: same triple loop as FloydWarshall.cpp over a vector of rows
+std::vector<std::vector<int>> tripleLoop(const std::vector<edge>& edges, int n) {
+    std::vector<std::vector<int>> adj_matrix(n, std::vector<int>(n, INT_MAX));
+    std::vector<std::vector<int>> fp_matrix(n, std::vector<int>(n, -1));
+    for (int i = 0; i < n; i++) adj_matrix[i][i] = 0;
+    for (const auto& e : edges) {
+        if (e.weight >= adj_matrix[e.from][e.to]) continue;
+        adj_matrix[e.from][e.to] = e.weight;
+        fp_matrix[e.from][e.to] = e.to;
+    }
+    for (int k = 0; k < n; k++) {
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                if (adj_matrix[i][k] == INT_MAX || adj_matrix[k][j] == INT_MAX) continue;
+                if (adj_matrix[i][k] + adj_matrix[k][j] < adj_matrix[i][j]) {
+                    adj_matrix[i][j] = adj_matrix[i][k] + adj_matrix[k][j];
+                    fp_matrix[i][j] = fp_matrix[i][k];
+                }
+            }
+        }
+    }
+    return adj_matrix;
+}
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// sample test case & benchmark for blocked floyd warshall
+int main() {
+    int n = 5;
+    std::vector<edge> edges = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, -2}, {0, 4, 9}};
+    BlockedFloydWarshall fw(edges, n, true);
+    fw.run();
+    std::cout << "Sample shortest path matrix:\n" << std::left;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (fw.distance(i, j) == INT_MAX) std::cout << std::setw(5) << "+Inf" << ' ';
+            else std::cout << std::setw(5) << fw.distance(i, j) << ' ';
+        }
+        std::cout << '\n';
+    }
+    std::vector<int> path = fw.path(0, 4);
+    std::cout << "\nVertex 0 to 4: " << path[0];
+    for (std::size_t i = 1; i < path.size(); i++) std::cout << " -> " << path[i];
+    edges.push_back({2, 2, -3});
+    BlockedFloydWarshall cyclic(edges, n);
+    cyclic.run();
+    std::cout << "\nNegative cycle " << (cyclic.hasNegativeCycle() ? "detected" : "not detected") << '\n';
+
+#ifdef __AVX2__
+    std::cout << "\nkernel: avx2\n";
+#else
+    std::cout << "\nkernel: scalar (compile with -mavx2 for the simd kernel)\n";
+#endif
+    // triple loop is only timed up to 2K vertices, it takes minutes beyond that
+    std::cout << std::left << std::setw(10) << "n" << std::setw(18) << "triple loop (ms)" << std::setw(16) << "blocked (ms)"
+              << std::setw(20) << "blocked+paths (ms)" << std::setw(12) << "speedup" << "matches" << '\n';
+    for (int size : {1024, 2048, 4096}) {
+        std::vector<edge> random = erdosRenyiGraph(size, 8ull * size, 42, 1, 100);
+        auto start = std::chrono::steady_clock::now();
+        BlockedFloydWarshall blocked(random, size);
+        blocked.run();
+        double blocked_ms = elapsed(start);
+        start = std::chrono::steady_clock::now();
+        BlockedFloydWarshall with_paths(random, size, true);
+        with_paths.run();
+        double paths_ms = elapsed(start);
+        std::cout << std::setw(10) << size;
+        if (size <= 2048) {
+            start = std::chrono::steady_clock::now();
+            std::vector<std::vector<int>> expected = tripleLoop(random, size);
+            double base_ms = elapsed(start);
+            bool match = true;
+            for (int i = 0; i < size; i++)
+                for (int j = 0; j < size; j++)
+                    if (expected[i][j] != blocked.distance(i, j) || expected[i][j] != with_paths.distance(i, j)) match = false;
+            std::cout << std::setw(18) << base_ms << std::setw(16) << blocked_ms << std::setw(20) << paths_ms << std::setw(12)
+                      << base_ms / blocked_ms << (match ? "yes" : "no") << '\n';
+        } else
+            std::cout << std::setw(18) << "-" << std::setw(16) << blocked_ms << std::setw(20) << paths_ms << std::setw(12) << "-" << "-" << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include <vector>
+#include <climits>
+#include <algorithm>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "Graph.h"
+
+/* blocked floyd warshall - time complexity O(V^3), but cache & simd friendly
+//   - distances live in one contiguous row-major matrix, rows padded to a multiple of BLOCK, so a BLOCK x BLOCK tile fits in L1
+//   - for every diagonal block kb: (1) update tile (kb, kb) through its own vertices, (2) update the row & column
+//     panels through tile (kb, kb), (3) update every other tile (ib, jb) through panel tiles (ib, kb) & (kb, jb)
+//   - phase 3 tiles only read finished panels, so they are spread across threads; phase 2 tiles are independent too
+//   - INF is a large sentinel instead of INT_MAX, so a + b never overflows & the inner loop has no branch; sums are
+//     clamped at -INF so negative cycles can't wrap around; entries >= INF / 2 are treated as unreachable
+//   - optional forward pointer matrix (same convention as fp_matrix in FloydWarshall.cpp) is updated with a blend,
+//     groups of 8 entries without any improvement skip both stores
+// note: finite path costs must stay within (-INF / 2, INF / 2); distances are meaningless if a negative cycle exists
+*/
+class BlockedFloydWarshall {
+    public:
+        static constexpr int INF = 1 << 29;
+        static constexpr std::size_t BLOCK = 64;
+
+    private:
+        std::size_t n, stride, blocks;
+        std::vector<int> dist; // stride x stride distance matrix
+        std::vector<int> next; // stride x stride forward pointers (empty if paths aren't tracked)
+
+        // c[i][j] = min(c[i][j], a[i][k] + b[k][j]) for k, then i, then j in tile; k outermost so c may alias a or b
+        void updateTile(std::size_t ib, std::size_t jb, std::size_t kb) {
+            std::size_t c_off = ib * BLOCK * stride + jb * BLOCK, a_off = ib * BLOCK * stride + kb * BLOCK, b_off = kb * BLOCK * stride + jb * BLOCK;
+            int* c = dist.data() + c_off;
+            const int* a = dist.data() + a_off;
+            const int* b = dist.data() + b_off;
+            int* cn = next.empty() ? nullptr : next.data() + c_off;
+            const int* an = next.empty() ? nullptr : next.data() + a_off;
+            for (std::size_t k = 0; k < BLOCK; k++) {
+                const int* brow = b + k * stride;
+                for (std::size_t i = 0; i < BLOCK; i++) {
+                    int aik = a[i * stride + k];
+                    if (aik >= INF / 2) continue;
+                    int* crow = c + i * stride;
+#ifdef __AVX2__
+                    __m256i va = _mm256_set1_epi32(aik), lo = _mm256_set1_epi32(-INF);
+                    if (cn) {
+                        int* nrow = cn + i * stride;
+                        __m256i vn = _mm256_set1_epi32(an[i * stride + k]);
+                        for (std::size_t j = 0; j < BLOCK; j += 8) {
+                            __m256i sum = _mm256_max_epi32(_mm256_add_epi32(va, _mm256_loadu_si256((const __m256i*) (brow + j))), lo);
+                            __m256i cur = _mm256_loadu_si256((const __m256i*) (crow + j));
+                            __m256i mask = _mm256_cmpgt_epi32(cur, sum);
+                            if (_mm256_testz_si256(mask, mask)) continue;
+                            _mm256_storeu_si256((__m256i*) (crow + j), _mm256_min_epi32(cur, sum));
+                            __m256i nxt = _mm256_loadu_si256((const __m256i*) (nrow + j));
+                            _mm256_storeu_si256((__m256i*) (nrow + j), _mm256_blendv_epi8(nxt, vn, mask));
+                        }
+                    } else {
+                        for (std::size_t j = 0; j < BLOCK; j += 8) {
+                            __m256i sum = _mm256_max_epi32(_mm256_add_epi32(va, _mm256_loadu_si256((const __m256i*) (brow + j))), lo);
+                            __m256i cur = _mm256_loadu_si256((const __m256i*) (crow + j));
+                            _mm256_storeu_si256((__m256i*) (crow + j), _mm256_min_epi32(cur, sum));
+                        }
+                    }
+#else
+                    int* nrow = cn ? cn + i * stride : nullptr;
+                    int nik = cn ? an[i * stride + k] : -1;
+                    for (std::size_t j = 0; j < BLOCK; j++) {
+                        int sum = aik + brow[j];
+                        if (sum >= crow[j]) continue;
+                        crow[j] = std::max(sum, -INF);
+                        if (nrow) nrow[j] = nik;
+                    }
+#endif
+                }
+            }
+        }
+
+    public:
+        // builds padded matrix from edge set (parallel edges keep the cheapest weight)
+        BlockedFloydWarshall(const std::vector<edge>& edges, int p_n, bool track_paths = false)
+            : n(p_n), stride((p_n + BLOCK - 1) / BLOCK * BLOCK), blocks(stride / BLOCK), dist(stride * stride, INF) {
+            if (track_paths) next.assign(stride * stride, -1);
+            for (std::size_t i = 0; i < n; i++) dist[i * stride + i] = 0;
+            for (const auto& e : edges) {
+                int w = (int) e.weight;
+                int& d = dist[(std::size_t) e.from * stride + e.to];
+                if (w >= d) continue;
+                d = w;
+                if (track_paths) next[(std::size_t) e.from * stride + e.to] = e.to;
+            }
+        }
+
+        void run(unsigned threads = defaultThreads()) {
+            for (std::size_t kb = 0; kb < blocks; kb++) {
+                updateTile(kb, kb, kb);
+                parallelFor(0, blocks, [&](unsigned, std::size_t lo, std::size_t hi) {
+                    for (std::size_t b = lo; b < hi; b++) {
+                        if (b == kb) continue;
+                        updateTile(kb, b, kb);
+                        updateTile(b, kb, kb);
+                    }
+                }, threads, 1);
+                parallelFor(0, blocks, [&](unsigned, std::size_t lo, std::size_t hi) {
+                    for (std::size_t ib = lo; ib < hi; ib++) {
+                        if (ib == kb) continue;
+                        for (std::size_t jb = 0; jb < blocks; jb++)
+                            if (jb != kb) updateTile(ib, jb, kb);
+                    }
+                }, threads, 1);
+            }
+        }
+
+        std::size_t size() const { return n; }
+        std::size_t rowStride() const { return stride; }
+        const std::vector<int>& distanceMatrix() const { return dist; }
+        const std::vector<int>& nextMatrix() const { return next; }
+
+        // shortest path cost from i to j (INT_MAX if unreachable)
+        int distance(int i, int j) const {
+            int d = dist[(std::size_t) i * stride + j];
+            return d >= INF / 2 ? INT_MAX : d;
+        }
+
+        // a negative cycle exists iff some vertex reaches itself at negative cost
+        bool hasNegativeCycle() const {
+            for (std::size_t i = 0; i < n; i++)
+                if (dist[i * stride + i] < 0) return true;
+            return false;
+        }
+
+        // vertices traversed along shortest path from src to dest (empty if paths aren't tracked or dest is unreachable)
+        std::vector<int> path(int src, int dest) const {
+            std::vector<int> path;
+            if (next.empty() || distance(src, dest) == INT_MAX) return path;
+            path.push_back(src);
+            for (int v = next[(std::size_t) src * stride + dest]; v != -1; v = next[(std::size_t) v * stride + dest])
+                path.push_back(v);
+            return path;
+        }
+};
@@ -0,0 +1,105 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Reorder.h"
+#include "Generators.h"
+#include "ParallelBFS.h"
+#include "DijkstraEngine.h"
+#include "CompressedGraph.h"
+
+typedef CSRGraph<int, double> csr_t;
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::size_t csrBytes(const csr_t& graph) {
+    return graph.offsetArray().size() * sizeof(std::size_t) + graph.edgeCount() * (sizeof(int) + sizeof(double));
+}
+
+// full scan of every neighbor list through neighbors(v), returns ms & a checksum
+template <typename G>
+double scan(const G& graph, double& checksum) {
+    auto start = std::chrono::steady_clock::now();
+    checksum = 0;
+    for (std::size_t v = 0; v < graph.vertexCount(); v++)
+        for (auto [next, weight] : graph.neighbors(v)) checksum += next + weight;
+    return elapsed(start);
+}
+
+// bytes / edge, decode throughput & dijkstra's / bfs time of compressed vs plain csr graphs
+template <typename Q>
+void report(const std::string& name, const std::string& storage, const csr_t& csr, const std::vector<int>& sources) {
+    auto start = std::chrono::steady_clock::now();
+    CompressedGraph<int, double, Q> graph(csr);
+    double build_ms = elapsed(start);
+    double expected, checksum;
+    double csr_ms = scan(csr, expected), ms = scan(graph, checksum);
+    std::vector<int> targets(graph.edgeCount() + 3);
+    start = std::chrono::steady_clock::now();
+    for (std::size_t v = 0; v < graph.vertexCount(); v++) graph.decodeTargets(v, targets.data() + csr.offsetArray()[v]);
+    double bulk_ms = elapsed(start);
+    targets.resize(graph.edgeCount());
+    bool same = checksum == expected && targets == csr.targetArray();
+
+    DijkstraEngine<csr_t> plain(csr);
+    DijkstraEngine<CompressedGraph<int, double, Q>> engine(graph);
+    ParallelBFS<csr_t> plain_bfs(csr);
+    ParallelBFS<CompressedGraph<int, double, Q>> bfs(graph);
+    double dijkstra_ms[2] = {0, 0}, bfs_ms[2] = {0, 0};
+    for (int s : sources) {
+        start = std::chrono::steady_clock::now();
+        plain.run(s);
+        dijkstra_ms[0] += elapsed(start);
+        start = std::chrono::steady_clock::now();
+        engine.run(s);
+        dijkstra_ms[1] += elapsed(start);
+        start = std::chrono::steady_clock::now();
+        plain_bfs.run(s);
+        bfs_ms[0] += elapsed(start);
+        start = std::chrono::steady_clock::now();
+        bfs.run(s);
+        bfs_ms[1] += elapsed(start);
+        for (std::size_t v = 0; v < csr.vertexCount(); v++)
+            same = same && plain.distance(v) == engine.distance(v) && plain_bfs.depth(v) == bfs.depth(v);
+    }
+    double m = graph.edgeCount();
+    std::cout << std::setw(18) << name << std::setw(10) << storage << std::setw(12) << (double) graph.memoryBytes() / m << std::setw(12)
+              << build_ms << std::setw(14) << m / ms / 1e3 << std::setw(14) << m / bulk_ms / 1e3 << std::setw(14) << m / csr_ms / 1e3
+              << std::setw(18) << (std::to_string((int) dijkstra_ms[1]) + " / " + std::to_string((int) dijkstra_ms[0]))
+              << std::setw(14) << (std::to_string((int) bfs_ms[1]) + " / " + std::to_string((int) bfs_ms[0])) << (same ? "yes" : "no") << '\n';
+}
+
+// sample test case & compression benchmark
+int main() {
+    std::vector<edge> sample = {{0, 1, 4}, {0, 2, 1}, {2, 1, 2}, {1, 3, 1}, {2, 3, 5}, {3, 4, 3}, {4, 0, 70000}};
+    CompressedGraph<int, double, std::uint16_t> small(sample, 5);
+    for (int v = 0; v < 5; v++) {
+        std::cout << v << ":";
+        for (auto [next, weight] : small.neighbors(v)) std::cout << ' ' << next << " (" << weight << ')';
+        std::cout << '\n';
+    }
+    std::cout << "weight range 1 - 70000 doesn't fit in 16 bits, so weights are rounded to steps of 2" << '\n';
+
+    const int scale = 20, n = 1 << scale;
+    std::vector<std::pair<std::string, csr_t>> families;
+    families.push_back({"geometric 1M", csr_t(geometricGraph(n, 4, 42, 1000), n)});
+    families.push_back({"r-mat 2^20", csr_t(rmatGraph(scale, 16ull * n, 42, 1, 1000), n)});
+    families.push_back({"r-mat 2^20, bfs", relabel(families.back().second, vertexOrder(families.back().second, BFS_ORDER))});
+    families.push_back({"geometric 1M, rcm", relabel(families[0].second, vertexOrder(families[0].second, RCM_ORDER))});
+    std::cout << '\n' << std::left << std::setw(18) << "graph" << std::setw(10) << "weights" << std::setw(12) << "bytes/edge" << std::setw(12)
+              << "build (ms)" << std::setw(14) << "iter (M e/s)" << std::setw(14) << "bulk (M e/s)" << std::setw(14) << "csr (M e/s)"
+              << std::setw(18) << "dijkstra (ms)" << std::setw(14) << "bfs (ms)" << "same" << '\n';
+    for (auto& [name, csr] : families) {
+        std::vector<int> sources;
+        std::mt19937 rng(9);
+        while (sources.size() < 1) {
+            int s = rng() % n;
+            if (csr.degree(s) > 0) sources.push_back(s);
+        }
+        std::cout << std::setw(18) << name << std::setw(10) << "csr" << std::setw(12) << (double) csrBytes(csr) / csr.edgeCount() << '\n';
+        report<double>(name, "double", csr, sources);
+        report<std::uint16_t>(name, "uint16", csr, sources);
+    }
+    return 0;
+}
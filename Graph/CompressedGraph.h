@@ -0,0 +1,283 @@
+#pragma once
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#ifdef __SSSE3__
+#include <immintrin.h>
+#endif
+#include "Graph.h"
+
+/* compressed csr graph - same read interface as CSRGraph (vertexCount(), edgeCount(), degree(v), neighbors(v))
+//   - each vertex's list is one byte run: degree (varint), weights, stream vbyte control bytes, gap data bytes, so
+//     the only per-vertex index is one byte offset & a scan touches one contiguous run per vertex
+//   - neighbor ids are sorted, so they are stored as gaps: the first as zigzag(target - v), the rest as
+//     target - previous target, which stay small for local or reordered graphs (see Reorder.h)
+//   - stream vbyte: one control byte holds the byte lengths (1 - 4) of four gaps, so a group of four is decoded with
+//     one pshufb & a 4 lane prefix sum (ssse3), with a scalar fallback otherwise
+//   - weights are kept as Q: Q == W stores them unchanged, a smaller integer Q (e.g. uint16_t) stores
+//     round((w - min) / scale); scale is 1 (exact) when weights are integers whose range fits in Q, else lossy
+//   - neighbors(v) decodes lazily, four gaps at a time, into a block held by the iterator, so ranges don't share
+//     scratch space & can be used concurrently & nested
+// @template
+//   - V: 32 bit vertex id type (decodeTargets writes 32 bit ids into V buffers), W: edge weight type, Q: stored weight type
+*/
+template <typename V = int, typename W = double, typename Q = W>
+class CompressedGraph {
+    static_assert(sizeof(V) == 4, "compressed graph decodes targets as 32 bit ids");
+    static_assert(std::is_same<Q, W>::value || std::is_integral<Q>::value, "quantized weights must be an integer type");
+
+    public:
+        typedef V vertex_type;
+        typedef W weight_type;
+
+    private:
+        static constexpr bool QUANTIZED = !std::is_same<Q, W>::value;
+
+        std::size_t n, m;
+        std::vector<std::size_t> byte_offsets; // start of each vertex's byte run
+        std::vector<std::uint8_t> bytes; // all runs, padded by 16 bytes for unaligned group loads
+        W base = 0, scale = 1; // dequantized weight = base + q * scale
+
+        // decoded header of one vertex's run
+        struct List {
+            std::size_t degree;
+            const std::uint8_t* weights;
+            const std::uint8_t* control;
+            const std::uint8_t* data;
+        };
+
+        static std::uint32_t zigzag(std::int64_t x) { return (std::uint32_t) ((x << 1) ^ (x >> 63)); }
+        static std::int64_t unzigzag(std::uint32_t x) { return (std::int64_t) (x >> 1) ^ -(std::int64_t) (x & 1); }
+        static unsigned byteLength(std::uint32_t x) { return x < (1u << 8) ? 1 : x < (1u << 16) ? 2 : x < (1u << 24) ? 3 : 4; }
+        static unsigned varintLength(std::size_t x) { unsigned len = 1; while (x >= 128) { x >>= 7; len++; } return len; }
+
+        struct Tables {
+            std::uint8_t length[256]; // data bytes of a group with given control byte
+            std::uint8_t shuffle[256][16]; // pshufb mask spreading those bytes into four 32 bit lanes
+            Tables() {
+                for (int c = 0; c < 256; c++) {
+                    int pos = 0;
+                    for (int lane = 0; lane < 4; lane++) {
+                        int len = ((c >> (2 * lane)) & 3) + 1;
+                        for (int b = 0; b < 4; b++) shuffle[c][lane * 4 + b] = b < len ? pos + b : 0x80;
+                        pos += len;
+                    }
+                    length[c] = pos;
+                }
+            }
+        };
+
+        static const Tables& tables() {
+            static const Tables t;
+            return t;
+        }
+
+        /* decodes one group of four gaps into targets, returns # of data bytes consumed
+        //   - prev: last target of previous group, first_fix: added to lane 0 before the prefix sum (turns the first
+        //     list entry's zigzag gap into an offset from 0); all arithmetic wraps mod 2^32
+        */
+        static unsigned decodeGroup(std::uint8_t control, const std::uint8_t* data, std::uint32_t prev, std::uint32_t first_fix, std::uint32_t* out) {
+            const Tables& t = tables();
+#ifdef __SSSE3__
+            __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) data), _mm_loadu_si128((const __m128i*) t.shuffle[control]));
+            x = _mm_add_epi32(x, _mm_cvtsi32_si128((int) first_fix));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+            _mm_storeu_si128((__m128i*) out, _mm_add_epi32(x, _mm_set1_epi32((int) prev)));
+#else
+            const std::uint8_t* p = data;
+            for (int lane = 0; lane < 4; lane++) {
+                unsigned len = ((control >> (2 * lane)) & 3) + 1;
+                std::uint32_t x = 0;
+                std::memcpy(&x, p, len); // little endian
+                prev += x + (lane == 0 ? first_fix : 0);
+                out[lane] = prev;
+                p += len;
+            }
+#endif
+            return t.length[control];
+        }
+
+        // decodes group i / 4 of a list, first group fixes up the zigzag encoded first gap
+        static unsigned decodeGroup(const List& list, V v, std::size_t i, const std::uint8_t* data, std::uint32_t prev, std::uint32_t* out) {
+            std::uint8_t control = list.control[i / 4];
+            std::uint32_t fix = 0;
+            if (i == 0) {
+                std::uint32_t raw = 0;
+                std::memcpy(&raw, data, (control & 3) + 1);
+                fix = (std::uint32_t) (v + unzigzag(raw)) - raw;
+            }
+            return decodeGroup(control, data, prev, fix, out);
+        }
+
+        List list(V v) const {
+            const std::uint8_t* p = bytes.data() + byte_offsets[v];
+            std::size_t deg = 0;
+            for (unsigned shift = 0; ; shift += 7) {
+                deg |= (std::size_t) (*p & 127) << shift;
+                if (!(*p++ & 128)) break;
+            }
+            const std::uint8_t* control = p + deg * sizeof(Q);
+            return {deg, p, control, control + (deg + 3) / 4};
+        }
+
+        // encodes one vertex's run (or only measures it when out is null), returns its size in bytes
+        std::size_t encode(V v, const V* targets, const W* w, std::size_t deg, std::uint8_t* out) const {
+            std::size_t size = varintLength(deg) + deg * sizeof(Q) + (deg + 3) / 4;
+            std::vector<std::uint32_t> gaps(deg);
+            for (std::size_t i = 0; i < deg; i++) {
+                gaps[i] = i == 0 ? zigzag((std::int64_t) targets[0] - v) : (std::uint32_t) (targets[i] - targets[i - 1]);
+                size += byteLength(gaps[i]);
+            }
+            if (!out) return size;
+            for (std::size_t x = deg; ; x >>= 7) {
+                *out++ = (x & 127) | (x >= 128 ? 128 : 0);
+                if (x < 128) break;
+            }
+            for (std::size_t i = 0; i < deg; i++) {
+                Q q = quantize(w[i]);
+                std::memcpy(out + i * sizeof(Q), &q, sizeof(Q));
+            }
+            std::uint8_t* control = out + deg * sizeof(Q);
+            std::uint8_t* data = control + (deg + 3) / 4;
+            for (std::size_t i = 0; i < deg; i++) {
+                unsigned len = byteLength(gaps[i]);
+                if (i % 4 == 0) control[i / 4] = 0;
+                control[i / 4] |= (len - 1) << (2 * (i % 4));
+                std::memcpy(data, &gaps[i], len); // little endian
+                data += len;
+            }
+            return size;
+        }
+
+        Q quantize(W w) const {
+            if constexpr (!QUANTIZED) return w;
+            else return (Q) std::llround((double) (w - base) / (double) scale);
+        }
+
+        W weightAt(const std::uint8_t* p) const {
+            Q q;
+            std::memcpy(&q, p, sizeof(Q));
+            if constexpr (QUANTIZED) return base + (W) q * scale;
+            else return q;
+        }
+
+    public:
+        // range over out-edges of a vertex, iterates as {target, weight} pairs
+        class NeighborRange {
+            private:
+                const CompressedGraph* g;
+                V v;
+                List l;
+
+            public:
+                class iterator {
+                    private:
+                        const CompressedGraph* g;
+                        const List* l;
+                        V v;
+                        const std::uint8_t* data;
+                        std::size_t i;
+                        std::uint32_t block[4];
+
+                        void load() { data += decodeGroup(*l, v, i, data, i == 0 ? 0 : block[3], block); }
+
+                    public:
+                        iterator(const CompressedGraph* p_g, const List* p_l, V p_v, std::size_t p_i) : g(p_g), l(p_l), v(p_v), data(p_l->data), i(p_i) {
+                            if (i < l->degree) load();
+                        }
+                        std::pair<V, W> operator*() const { return {(V) block[i & 3], g->weightAt(l->weights + i * sizeof(Q))}; }
+                        iterator& operator++() {
+                            if ((++i & 3) == 0 && i < l->degree) load();
+                            return *this;
+                        }
+                        bool operator!=(const iterator& other) const { return i != other.i; }
+                        bool operator==(const iterator& other) const { return i == other.i; }
+                };
+
+                NeighborRange(const CompressedGraph* p_g, V p_v) : g(p_g), v(p_v), l(p_g->list(p_v)) {}
+                iterator begin() const { return iterator(g, &l, v, 0); }
+                iterator end() const { return iterator(g, &l, v, l.degree); }
+                std::size_t size() const { return l.degree; }
+        };
+
+        CompressedGraph() : n(0), m(0), byte_offsets(1, 0), bytes(16, 0) {}
+
+        // compresses a csr graph (neighbor lists are already sorted by target)
+        CompressedGraph(const CSRGraph<V, W>& graph, unsigned threads = defaultThreads()) : n(graph.vertexCount()), m(graph.edgeCount()) {
+            const auto& offsets = graph.offsetArray();
+            const auto& targets = graph.targetArray();
+            const auto& w = graph.weightArray();
+            if constexpr (QUANTIZED) {
+                if (!w.empty()) {
+                    W lo = *std::min_element(w.begin(), w.end()), hi = *std::max_element(w.begin(), w.end());
+                    double levels = (double) std::numeric_limits<Q>::max();
+                    bool integral = std::all_of(w.begin(), w.end(), [](W x) { return x == (W) std::llround((double) x); });
+                    base = lo;
+                    if (integral) scale = std::max<W>(1, (W) std::ceil((double) (hi - lo) / levels));
+                    else scale = hi > lo ? (W) ((hi - lo) / levels) : 1;
+                }
+            }
+            byte_offsets.assign(n + 1, 0);
+            parallelFor(0, n, [&](unsigned, std::size_t lo, std::size_t hi) {
+                for (std::size_t v = lo; v < hi; v++)
+                    byte_offsets[v + 1] = encode(v, targets.data() + offsets[v], w.data() + offsets[v], offsets[v + 1] - offsets[v], nullptr);
+            }, threads, 1 << 12);
+            for (std::size_t v = 0; v < n; v++) byte_offsets[v + 1] += byte_offsets[v];
+            bytes.assign(byte_offsets[n] + 16, 0);
+            parallelFor(0, n, [&](unsigned, std::size_t lo, std::size_t hi) {
+                for (std::size_t v = lo; v < hi; v++)
+                    encode(v, targets.data() + offsets[v], w.data() + offsets[v], offsets[v + 1] - offsets[v], bytes.data() + byte_offsets[v]);
+            }, threads, 1 << 12);
+        }
+
+        // builds graph on vertices [0, n) from an edge set with from, to & weight fields
+        template <typename E>
+        CompressedGraph(const std::vector<E>& edges, std::size_t p_n, unsigned threads = defaultThreads())
+            : CompressedGraph(CSRGraph<V, W>(edges, p_n, threads), threads) {}
+
+        std::size_t vertexCount() const { return n; }
+        std::size_t edgeCount() const { return m; }
+        std::size_t degree(V v) const { return list(v).degree; }
+
+        // out-edges of vertex v
+        NeighborRange neighbors(V v) const { return NeighborRange(this, v); }
+
+        // decodes all out-neighbors of v into out (room for degree(v) + 3 entries), returns degree
+        std::size_t decodeTargets(V v, V* out) const {
+            List l = list(v);
+            const std::uint8_t* data = l.data;
+            std::uint32_t prev = 0;
+            for (std::size_t i = 0; i < l.degree; i += 4) {
+                data += decodeGroup(l, v, i, data, prev, (std::uint32_t*) out + i);
+                prev = out[i + 3];
+            }
+            return l.degree;
+        }
+
+        // bytes held by offsets & byte runs
+        std::size_t memoryBytes() const { return byte_offsets.size() * sizeof(std::size_t) + bytes.size(); }
+
+        // decompressed copy (quantized weights stay rounded)
+        CSRGraph<V, W> toCSRGraph() const {
+            std::vector<std::size_t> offsets(n + 1, 0);
+            for (std::size_t v = 0; v < n; v++) offsets[v + 1] = offsets[v] + degree(v);
+            std::vector<V> targets(m + 3);
+            std::vector<W> w(m);
+            for (std::size_t v = 0; v < n; v++) {
+                decodeTargets(v, targets.data() + offsets[v]);
+                List l = list(v);
+                for (std::size_t i = 0; i < l.degree; i++) w[offsets[v] + i] = weightAt(l.weights + i * sizeof(Q));
+            }
+            targets.resize(m);
+            return CSRGraph<V, W>(std::move(offsets), std::move(targets), std::move(w));
+        }
+
+        // builds reverse graph (every edge u -> v becomes v -> u)
+        CompressedGraph transpose(unsigned threads = defaultThreads()) const {
+            return CompressedGraph(toCSRGraph().transpose(threads), threads);
+        }
+};
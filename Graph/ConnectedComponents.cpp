@@ -0,0 +1,78 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "ConnectedComponents.h"
+
+typedef CSRGraph<int, int> graph_t;
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// sequential baseline: bfs over the undirected view (graph & its reverse), labels each component with its smallest vertex
+std::vector<int> bfsComponents(const graph_t& graph, const graph_t& reverse) {
+    int n = graph.vertexCount();
+    std::vector<int> label(n, -1), queue;
+    for (int root = 0; root < n; root++) {
+        if (label[root] != -1) continue;
+        label[root] = root;
+        queue.assign(1, root);
+        for (std::size_t head = 0; head < queue.size(); head++) {
+            int u = queue[head];
+            for (const graph_t* g : {&graph, &reverse}) {
+                for (auto [v, weight] : g->neighbors(u)) {
+                    if (label[v] != -1) continue;
+                    label[v] = root;
+                    queue.push_back(v);
+                }
+            }
+        }
+    }
+    return label;
+}
+
+// sample test case & gteps of afforest vs shiloach vishkin vs sequential bfs
+int main() {
+    std::vector<edge> sample = {{0, 1}, {2, 1}, {3, 4}, {5, 3}, {6, 6}};
+    std::vector<int> label = connectedComponents(sample, 7);
+    std::cout << std::left << std::setw(10) << "Vertex" << "Component" << '\n';
+    for (int v = 0; v < 7; v++) std::cout << std::setw(10) << v << label[v] << '\n';
+
+    const int scale = 21, n = 1 << scale;
+    std::vector<std::pair<std::string, std::vector<edge>>> families;
+    families.push_back({"grid 1448x1448", gridGraph(1448, 42)});
+    families.push_back({"geometric 2M", geometricGraph(n, 2, 42)});
+    families.push_back({"erdos-renyi 2M", erdosRenyiGraph(n, 4ull * n, 42)});
+    families.push_back({"r-mat 2^21", rmatGraph(scale, 16ull * n, 42)});
+    std::cout << '\n' << std::setw(16) << "graph" << std::setw(20) << "method" << std::setw(10) << "threads" << std::setw(12) << "ms"
+              << std::setw(10) << "GTEPS" << std::setw(14) << "components" << "same" << '\n';
+    std::vector<unsigned> thread_counts = {1};
+    if (defaultThreads() > 1) thread_counts.push_back(defaultThreads());
+    for (auto& [name, edges] : families) {
+        int vertices = name[0] == 'g' && name[1] == 'r' ? 1448 * 1448 : n;
+        graph_t graph(edges, vertices);
+        std::vector<edge>().swap(edges);
+        const graph_t reverse = graph.transpose();
+        bool symmetric = reverse.targetArray() == graph.targetArray();
+        auto start = std::chrono::steady_clock::now();
+        std::vector<int> expected = bfsComponents(graph, reverse);
+        double ms = elapsed(start);
+        std::size_t components = 0;
+        for (int v = 0; v < vertices; v++) components += expected[v] == v;
+        auto report = [&](const std::string& method, unsigned threads, double ms, bool same) {
+            std::cout << std::setw(16) << name << std::setw(20) << method << std::setw(10) << threads << std::setw(12) << ms << std::setw(10)
+                      << graph.edgeCount() / ms / 1e6 << std::setw(14) << components << (same ? "yes" : "no") << '\n';
+        };
+        report("sequential bfs", 1, ms, true);
+        for (unsigned threads : thread_counts) {
+            start = std::chrono::steady_clock::now();
+            bool same = shiloachVishkin(graph, threads) == expected;
+            report("shiloach vishkin", threads, elapsed(start), same);
+            start = std::chrono::steady_clock::now();
+            same = afforest(graph, !symmetric, threads) == expected;
+            report("afforest", threads, elapsed(start), same);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include <atomic>
+#include <random>
+#include <vector>
+#include <unordered_map>
+#include "Graph.h"
+
+/* parallel connected components - both return label[v] = smallest vertex id of v's component
+//   - edges are treated as undirected (weak components of a directed graph)
+//   - union find lives in one array comp[], roots are hooked larger id under smaller id with a compare & swap, so
+//     concurrent links never form a cycle & each tree root ends up being the minimum of its component
+*/
+
+namespace detail {
+    // hooks trees of u & v together (afforest link)
+    template <typename V>
+    void link(std::vector<std::atomic<V>>& comp, V u, V v) {
+        V p1 = comp[u].load(std::memory_order_relaxed), p2 = comp[v].load(std::memory_order_relaxed);
+        while (p1 != p2) {
+            V high = std::max(p1, p2), low = std::min(p1, p2);
+            V p_high = comp[high].load(std::memory_order_relaxed);
+            // high is a root & still unhooked: hook it under low
+            if (p_high == low) break;
+            if (p_high == high && comp[high].compare_exchange_strong(p_high, low, std::memory_order_relaxed)) break;
+            p1 = comp[comp[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+            p2 = comp[low].load(std::memory_order_relaxed);
+        }
+    }
+
+    // points every vertex directly at its root
+    template <typename V>
+    void compress(std::vector<std::atomic<V>>& comp, unsigned threads) {
+        parallelFor(0, comp.size(), [&](unsigned, std::size_t lo, std::size_t hi) {
+            for (std::size_t v = lo; v < hi; v++) {
+                V p = comp[v].load(std::memory_order_relaxed);
+                while (p != comp[p].load(std::memory_order_relaxed)) {
+                    V gp = comp[p].load(std::memory_order_relaxed);
+                    comp[v].store(gp, std::memory_order_relaxed);
+                    p = gp;
+                }
+            }
+        }, threads);
+    }
+
+    template <typename V>
+    std::vector<V> labels(const std::vector<std::atomic<V>>& comp) {
+        std::vector<V> result(comp.size());
+        for (std::size_t v = 0; v < comp.size(); v++) result[v] = comp[v].load(std::memory_order_relaxed);
+        return result;
+    }
+}
+
+/* shiloach vishkin - every round links the endpoints of every edge & compresses, until a round changes nothing
+//   - time complexity O(E log V) work worst case, but every round scans all edges
+*/
+template <typename G>
+std::vector<typename G::vertex_type> shiloachVishkin(const G& graph, unsigned threads = defaultThreads()) {
+    typedef typename G::vertex_type V;
+    std::size_t n = graph.vertexCount();
+    std::vector<std::atomic<V>> comp(n);
+    for (std::size_t v = 0; v < n; v++) comp[v].store((V) v, std::memory_order_relaxed);
+    std::atomic<bool> changed{true};
+    while (changed.load()) {
+        changed = false;
+        parallelFor(0, n, [&](unsigned, std::size_t lo, std::size_t hi) {
+            bool local = false;
+            for (std::size_t u = lo; u < hi; u++) {
+                for (auto [v, weight] : graph.neighbors(u)) {
+                    if (comp[u].load(std::memory_order_relaxed) == comp[v].load(std::memory_order_relaxed)) continue;
+                    detail::link(comp, (V) u, v);
+                    local = true;
+                }
+            }
+            if (local) changed = true;
+        }, threads, 1024);
+        detail::compress(comp, threads);
+    }
+    return detail::labels(comp);
+}
+
+/* afforest (sutton et al.) - skips most edges of the largest component
+//   - links each vertex to its first few neighbors only (neighbor_rounds), which usually merges the giant component
+//   - samples comp[] to guess the largest component c, then links every remaining edge of vertices outside c
+//   - an edge between c & another vertex is linked from the other end when edges are stored in both directions,
+//     otherwise vertices of c still scan their out-edges, but only link targets outside c (read-only check)
+// @params
+//   - directed: false if every edge is stored in both directions (vertices of c skip their edges entirely)
+*/
+template <typename G>
+std::vector<typename G::vertex_type> afforest(const G& graph, bool directed = true, unsigned threads = defaultThreads(),
+                                              std::size_t neighbor_rounds = 2) {
+    typedef typename G::vertex_type V;
+    std::size_t n = graph.vertexCount();
+    std::vector<std::atomic<V>> comp(n);
+    for (std::size_t v = 0; v < n; v++) comp[v].store((V) v, std::memory_order_relaxed);
+    if (n == 0) return {};
+
+    for (std::size_t r = 0; r < neighbor_rounds; r++) {
+        parallelFor(0, n, [&](unsigned, std::size_t lo, std::size_t hi) {
+            for (std::size_t u = lo; u < hi; u++) {
+                std::size_t i = 0;
+                for (auto [v, weight] : graph.neighbors(u)) {
+                    if (i++ < r) continue;
+                    detail::link(comp, (V) u, v);
+                    break;
+                }
+            }
+        }, threads, 1024);
+        detail::compress(comp, threads);
+    }
+
+    // most frequent label among 1024 samples
+    std::mt19937 rng(27491095);
+    std::unordered_map<V, std::size_t> counts;
+    V largest = 0;
+    for (int i = 0; i < 1024; i++) {
+        V c = comp[rng() % n].load(std::memory_order_relaxed);
+        if (++counts[c] > counts[largest]) largest = c;
+    }
+
+    parallelFor(0, n, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t u = lo; u < hi; u++) {
+            bool in_largest = comp[u].load(std::memory_order_relaxed) == largest;
+            if (in_largest && !directed) continue;
+            std::size_t i = 0;
+            for (auto [v, weight] : graph.neighbors(u)) {
+                if (i++ < neighbor_rounds) continue;
+                // v -> u may not exist, so edges from the largest component to other components are linked from here
+                if (in_largest && comp[v].load(std::memory_order_relaxed) == largest) continue;
+                detail::link(comp, (V) u, v);
+            }
+        }
+    }, threads, 1024);
+    detail::compress(comp, threads);
+    return detail::labels(comp);
+}
+
+// component labels directly from edge set (same input as dijkstra's & bellman ford samples)
+inline std::vector<int> connectedComponents(const std::vector<edge>& edges, int n, unsigned threads = defaultThreads()) {
+    return afforest(CSRGraph<int, double>(edges, n, threads), true, threads);
+}
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "DijkstraEngine.h"
+#include "ContractionHierarchy.h"
+
+typedef CSRGraph<int, double> graph_t;
+
+// prints vertices of a path in the same format as constructShortestPath samples
+void printPath(const std::vector<int>& path) {
+    if (path.empty()) { std::cout << "unreachable" << '\n'; return; }
+    std::cout << path[0];
+    for (std::size_t i = 1; i < path.size(); i++)
+        std::cout << " -> " << path[i];
+    std::cout << '\n';
+}
+
+void benchmark(const std::string& name, const graph_t& graph, int queries) {
+    auto t0 = std::chrono::steady_clock::now();
+    ContractionHierarchy<graph_t> ch(graph);
+    auto t1 = std::chrono::steady_clock::now();
+    ch.save("hierarchy.ch");
+    ContractionHierarchy<graph_t> loaded = ContractionHierarchy<graph_t>::load("hierarchy.ch", graph);
+    std::remove("hierarchy.ch");
+
+    DijkstraEngine<graph_t> dijkstra(graph);
+    std::mt19937 rng(7);
+    double dijkstra_ms = 0, ch_ms = 0, settled = 0;
+    int mismatches = 0;
+    for (int q = 0; q < queries; q++) {
+        int s = rng() % graph.vertexCount(), t = rng() % graph.vertexCount();
+        auto a = std::chrono::steady_clock::now();
+        double d1 = dijkstra.runTo(s, t);
+        auto b = std::chrono::steady_clock::now();
+        double d2 = loaded.query(s, t);
+        auto c = std::chrono::steady_clock::now();
+        dijkstra_ms += std::chrono::duration<double, std::milli>(b - a).count();
+        ch_ms += std::chrono::duration<double, std::milli>(c - b).count();
+        settled += loaded.settledCount();
+        // unpacked path must have the same cost as the query distance
+        std::vector<int> path = loaded.path();
+        double cost = 0;
+        for (std::size_t i = 0; i + 1 < path.size(); i++) {
+            double best = DijkstraEngine<graph_t>::INF;
+            for (auto [next, weight] : graph.neighbors(path[i]))
+                if (next == path[i + 1]) best = std::min(best, weight);
+            cost += best;
+        }
+        if (d1 != d2 || (d1 != DijkstraEngine<graph_t>::INF && (path.front() != s || path.back() != t || cost != d1))) mismatches++;
+    }
+    std::cout << '\n' << name << " (n = " << graph.vertexCount() << ", m = " << graph.edgeCount() << ")\n"
+              << "preprocessing: " << std::chrono::duration<double>(t1 - t0).count() << "s, hierarchy arcs: " << ch.arcCount()
+              << ", mismatches: " << mismatches << '\n'
+              << std::left << std::setw(24) << "dijkstra ms/query" << std::setw(24) << "ch ms/query" << "ch settled/query" << '\n'
+              << std::setw(24) << dijkstra_ms / queries << std::setw(24) << ch_ms / queries << settled / queries << '\n';
+}
+
+// sample test case & benchmark for contraction hierarchies
+int main() {
+    std::vector<edge> edges = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, 5}, {0, 4, 5}};
+    graph_t graph(edges, 5);
+    ContractionHierarchy<graph_t> ch(graph);
+    std::cout << "Vertex 0 to 4: distance " << ch.query(0, 4) << ", path: ";
+    printPath(ch.path());
+    std::cout << "Vertex 1 to 4: distance " << ch.query(1, 4) << ", path: ";
+    printPath(ch.path());
+
+    // files built for another graph or other vertex / weight types are rejected instead of read out of bounds
+    ch.save("hierarchy.ch");
+    try {
+        ContractionHierarchy<graph_t>::load("hierarchy.ch", graph_t(edges, 6));
+    } catch (const std::invalid_argument& e) {
+        std::cout << "stale hierarchy rejected: " << e.what() << '\n';
+    }
+    try {
+        ContractionHierarchy<CSRGraph<int, float>>::load("hierarchy.ch");
+    } catch (const std::runtime_error& e) {
+        std::cout << "wrong types rejected: " << e.what() << '\n';
+    }
+    std::remove("hierarchy.ch");
+
+    benchmark("grid", graph_t(gridGraph(300, 42), 300 * 300), 200);
+    benchmark("road-like", graph_t(geometricGraph(200000, 3, 42), 200000), 200);
+    return 0;
+}
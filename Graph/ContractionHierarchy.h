@@ -0,0 +1,463 @@
+#pragma once
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <tuple>
+#include <algorithm>
+#include <functional>
+#include "Graph.h"
+
+/* contraction hierarchies - point to point shortest paths on static graphs
+// preprocessing:
+//   - contracts vertices one at a time in order of priority (edge difference + # contracted neighbors)
+//   - contracting v removes it & adds shortcut u -> w (via v) for each in-neighbor u & out-neighbor w,
+//     unless a witness search finds a path u -> w avoiding v that is no longer than u -> v -> w
+//   - priorities are updated lazily: popped vertex is re-evaluated & reinserted if it is no longer minimal
+//   - initial priorities are computed in parallel (each simulated contraction only reads graph)
+// query:
+//   - bidirectional dijkstra's where forward search only follows edges to higher ranked vertices (upward graph)
+//     & backward search only follows reverse edges to higher ranked vertices (downward graph)
+//   - shortcuts are recursively unpacked into original vertices
+// @template
+//   - G: graph type providing vertexCount() & neighbors(v) (e.g. CSRGraph)
+*/
+template <typename G>
+class ContractionHierarchy {
+    public:
+        typedef typename G::vertex_type V;
+        typedef typename G::weight_type W;
+
+        static constexpr W INF = std::numeric_limits<W>::max();
+
+    private:
+        typedef std::pair<W, V> entry;
+
+        // edge of search graph, middle is the contracted vertex a shortcut bypasses (-1 for original edges)
+        struct Arc {
+            V target;
+            W weight;
+            V middle;
+        };
+
+        // search graph in csr layout: arcs of vertex v are arcs[offsets[v] .. offsets[v + 1])
+        struct SearchGraph {
+            std::vector<std::size_t> offsets;
+            std::vector<Arc> arcs;
+        };
+
+        std::size_t n;
+        std::vector<V> rank; // contraction order of every vertex
+        SearchGraph up; // up[u] holds u -> w with rank[w] > rank[u]
+        SearchGraph down; // down[w] holds u -> w with rank[u] > rank[w], stored at w as arc to u
+
+        // query state for each direction, epoch stamped like DijkstraEngine
+        struct Search {
+            std::vector<W> dist;
+            std::vector<V> bp;
+            std::vector<std::uint32_t> reached;
+            std::vector<entry> min_heap;
+        };
+        Search fwd, bwd;
+        std::uint32_t epoch;
+        std::size_t settled_count;
+        W mu;
+        V meet;
+
+        // ---------- preprocessing ----------
+
+        // dynamic adjacency used while contracting
+        struct Builder {
+            std::vector<std::vector<Arc>> out, in;
+            std::vector<bool> contracted;
+            std::vector<int> contracted_neighbors;
+
+            // inserts or shortens edge u -> w
+            void addEdge(V u, V w, W weight, V middle) {
+                auto update = [&](std::vector<Arc>& list, V target) {
+                    for (auto& a : list) {
+                        if (a.target != target) continue;
+                        if (weight < a.weight) { a.weight = weight; a.middle = middle; }
+                        return;
+                    }
+                    list.push_back({target, weight, middle});
+                };
+                update(out[u], w);
+                update(in[w], u);
+            }
+        };
+
+        // per-thread scratch for bounded witness searches
+        struct Witness {
+            std::vector<W> dist;
+            std::vector<std::uint32_t> reached, target;
+            std::vector<entry> min_heap;
+            std::uint32_t epoch = 0;
+
+            Witness(std::size_t n) : dist(n), reached(n, 0), target(n, 0) {}
+
+            // dijkstra's from src over uncontracted vertices except skip, stops beyond max_dist or settle_limit vertices
+            // or once every out-neighbor of skip is settled
+            void search(const Builder& b, V src, V skip, W max_dist, int settle_limit) {
+                if (++epoch == 0) {
+                    std::fill(reached.begin(), reached.end(), 0);
+                    std::fill(target.begin(), target.end(), 0);
+                    epoch = 1;
+                }
+                int remaining = 0;
+                for (const Arc& o : b.out[skip])
+                    if (o.target != src && target[o.target] != epoch) { target[o.target] = epoch; remaining++; }
+                min_heap.clear();
+                reached[src] = epoch;
+                dist[src] = 0;
+                min_heap.push_back({0, src});
+                int settled = 0;
+                while (!min_heap.empty()) {
+                    std::pop_heap(min_heap.begin(), min_heap.end(), std::greater<entry>());
+                    auto [d, curr] = min_heap.back(); min_heap.pop_back();
+                    if (d != dist[curr]) continue;
+                    if (d > max_dist || ++settled > settle_limit) break;
+                    if (target[curr] == epoch && --remaining == 0) break;
+                    for (const Arc& a : b.out[curr]) {
+                        if (a.target == skip || b.contracted[a.target]) continue;
+                        W nd = d + a.weight;
+                        if (reached[a.target] == epoch && nd >= dist[a.target]) continue;
+                        reached[a.target] = epoch;
+                        dist[a.target] = nd;
+                        min_heap.push_back({nd, a.target});
+                        std::push_heap(min_heap.begin(), min_heap.end(), std::greater<entry>());
+                    }
+                }
+            }
+
+            W distance(V v) const { return reached[v] == epoch ? dist[v] : INF; }
+        };
+
+        // witness searches settle at most this many vertices (fewer when only estimating priorities)
+        static constexpr int settle_limit = 100, simulate_settle_limit = 30;
+
+        // simulates (or performs) contraction of v, returns number of shortcuts it needs
+        template <typename F>
+        static int contract(const Builder& b, Witness& witness, V v, int limit, F&& onShortcut) {
+            W max_out = 0;
+            for (const Arc& o : b.out[v])
+                if (!b.contracted[o.target]) max_out = std::max(max_out, o.weight);
+            int shortcuts = 0;
+            for (const Arc& i : b.in[v]) {
+                V u = i.target;
+                if (b.contracted[u]) continue;
+                witness.search(b, u, v, i.weight + max_out, limit);
+                for (const Arc& o : b.out[v]) {
+                    V w = o.target;
+                    if (b.contracted[w] || w == u) continue;
+                    if (witness.distance(w) <= i.weight + o.weight) continue;
+                    shortcuts++;
+                    onShortcut(u, w, i.weight + o.weight);
+                }
+            }
+            return shortcuts;
+        }
+
+        static int priority(const Builder& b, Witness& witness, V v) {
+            int degree = 0;
+            for (const Arc& a : b.out[v]) degree += !b.contracted[a.target];
+            for (const Arc& a : b.in[v]) degree += !b.contracted[a.target];
+            int shortcuts = contract(b, witness, v, simulate_settle_limit, [](V, V, W) {});
+            return shortcuts - degree + b.contracted_neighbors[v];
+        }
+
+        // packs per-vertex arc lists into a csr search graph
+        static void pack(SearchGraph& sg, std::vector<std::vector<Arc>>& lists) {
+            sg.offsets.assign(lists.size() + 1, 0);
+            for (std::size_t v = 0; v < lists.size(); v++)
+                sg.offsets[v + 1] = sg.offsets[v] + lists[v].size();
+            sg.arcs.clear();
+            sg.arcs.reserve(sg.offsets.back());
+            for (auto& list : lists) {
+                sg.arcs.insert(sg.arcs.end(), list.begin(), list.end());
+                std::vector<Arc>().swap(list);
+            }
+        }
+
+        void preprocess(const G& graph, unsigned threads) {
+            Builder b;
+            b.out.resize(n);
+            b.in.resize(n);
+            b.contracted.assign(n, false);
+            b.contracted_neighbors.assign(n, 0);
+            for (std::size_t u = 0; u < n; u++)
+                for (auto [w, weight] : graph.neighbors(u))
+                    if ((std::size_t) w != u) b.addEdge(u, w, weight, -1);
+
+            // initial priorities in parallel, one witness scratch per thread
+            std::vector<int> prio(n);
+            parallelFor(0, n, [&](unsigned, std::size_t lo, std::size_t hi) {
+                Witness witness(n);
+                for (std::size_t v = lo; v < hi; v++) prio[v] = priority(b, witness, v);
+            }, threads, 1 << 10);
+
+            typedef std::pair<int, V> pq_entry;
+            std::vector<pq_entry> queue;
+            for (std::size_t v = 0; v < n; v++) queue.push_back({prio[v], (V) v});
+            std::make_heap(queue.begin(), queue.end(), std::greater<pq_entry>());
+            Witness witness(n);
+            std::vector<std::tuple<V, V, W>> shortcuts;
+            std::vector<std::vector<Arc>> up_lists(n), down_lists(n);
+            rank.assign(n, 0);
+            V next_rank = 0;
+            while (!queue.empty()) {
+                std::pop_heap(queue.begin(), queue.end(), std::greater<pq_entry>());
+                V v = queue.back().second; queue.pop_back();
+                // lazy update: reinsert if recomputed priority is worse than next candidate
+                int p = priority(b, witness, v);
+                if (!queue.empty() && p > queue.front().first) {
+                    queue.push_back({p, v});
+                    std::push_heap(queue.begin(), queue.end(), std::greater<pq_entry>());
+                    continue;
+                }
+                shortcuts.clear();
+                contract(b, witness, v, settle_limit, [&](V u, V w, W weight) { shortcuts.push_back({u, w, weight}); });
+                for (auto [u, w, weight] : shortcuts) b.addEdge(u, w, weight, v);
+                b.contracted[v] = true;
+                rank[v] = next_rank++;
+                // remaining arcs of v all lead to higher ranked vertices, so they become v's hierarchy arcs
+                // & are detached from the working graph to keep later witness searches small
+                for (const Arc& a : b.out[v]) {
+                    b.contracted_neighbors[a.target]++;
+                    auto& in = b.in[a.target];
+                    in.erase(std::find_if(in.begin(), in.end(), [v](const Arc& x) { return x.target == v; }));
+                }
+                for (const Arc& a : b.in[v]) {
+                    b.contracted_neighbors[a.target]++;
+                    auto& out = b.out[a.target];
+                    out.erase(std::find_if(out.begin(), out.end(), [v](const Arc& x) { return x.target == v; }));
+                }
+                up_lists[v].swap(b.out[v]);
+                down_lists[v].swap(b.in[v]);
+            }
+            pack(up, up_lists);
+            pack(down, down_lists);
+        }
+
+        // ---------- query ----------
+
+        void resetSearch(Search& s) {
+            s.dist.resize(n);
+            s.bp.resize(n);
+            s.reached.assign(n, 0);
+        }
+
+        void relax(Search& s, V v, W d, V prev) {
+            if (s.reached[v] == epoch && d >= s.dist[v]) return;
+            s.reached[v] = epoch;
+            s.dist[v] = d;
+            s.bp[v] = prev;
+            s.min_heap.push_back({d, v});
+            std::push_heap(s.min_heap.begin(), s.min_heap.end(), std::greater<entry>());
+        }
+
+        // settles one vertex of search s over search graph sg
+        void step(Search& s, const Search& other, const SearchGraph& sg) {
+            std::pop_heap(s.min_heap.begin(), s.min_heap.end(), std::greater<entry>());
+            auto [d, curr] = s.min_heap.back(); s.min_heap.pop_back();
+            if (d != s.dist[curr]) return;
+            settled_count++;
+            if (other.reached[curr] == epoch && d + other.dist[curr] < mu) {
+                mu = d + other.dist[curr];
+                meet = curr;
+            }
+            for (std::size_t i = sg.offsets[curr]; i < sg.offsets[curr + 1]; i++)
+                relax(s, sg.arcs[i].target, d + sg.arcs[i].weight, curr);
+        }
+
+        // finds arc u -> w of hierarchy (stored in up[u] or down[w] depending on ranks)
+        const Arc& findArc(V u, V w) const {
+            const SearchGraph& sg = rank[w] > rank[u] ? up : down;
+            V from = rank[w] > rank[u] ? u : w, to = rank[w] > rank[u] ? w : u;
+            for (std::size_t i = sg.offsets[from]; i < sg.offsets[from + 1]; i++)
+                if (sg.arcs[i].target == to) return sg.arcs[i];
+            throw std::logic_error("hierarchy arc not found");
+        }
+
+        // appends original vertices of arc u -> w (excluding u) to path
+        void unpack(V u, V w, std::vector<V>& path) const {
+            const Arc& a = findArc(u, w);
+            if (a.middle == -1) {
+                path.push_back(w);
+                return;
+            }
+            unpack(u, a.middle, path);
+            unpack(a.middle, w, path);
+        }
+
+        // structural checks on a loaded hierarchy, see load
+        bool valid() const {
+            std::vector<char> seen(n, 0);
+            for (V r : rank) {
+                if (r < 0 || (std::size_t) r >= n || seen[r]) return false;
+                seen[r] = 1;
+            }
+            for (const SearchGraph* sg : {&up, &down}) {
+                if (sg->offsets[0] != 0 || sg->offsets[n] != sg->arcs.size()) return false;
+                for (std::size_t v = 0; v < n; v++) {
+                    if (sg->offsets[v] > sg->offsets[v + 1]) return false;
+                    for (std::size_t i = sg->offsets[v]; i < sg->offsets[v + 1]; i++) {
+                        const Arc& a = sg->arcs[i];
+                        if (a.target < 0 || (std::size_t) a.target >= n || rank[a.target] <= rank[v]) return false;
+                        if (a.middle != -1 && (a.middle < 0 || (std::size_t) a.middle >= n || rank[a.middle] >= rank[v])) return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+    public:
+        ContractionHierarchy() : n(0), epoch(0), settled_count(0), mu(INF), meet(-1) {}
+
+        ContractionHierarchy(const G& graph, unsigned threads = defaultThreads())
+            : n(graph.vertexCount()), epoch(0), settled_count(0), mu(INF), meet(-1) {
+            preprocess(graph, threads);
+            resetSearch(fwd);
+            resetSearch(bwd);
+        }
+
+        std::size_t vertexCount() const { return n; }
+        std::size_t arcCount() const { return up.arcs.size() + down.arcs.size(); }
+        std::size_t settledCount() const { return settled_count; }
+        V getRank(V v) const { return rank[v]; }
+
+        // upward & downward search graphs as {target, weight} lists, used by many-to-many bucket queries
+        template <typename F>
+        void forEachUpArc(V v, F&& fn) const {
+            for (std::size_t i = up.offsets[v]; i < up.offsets[v + 1]; i++) fn(up.arcs[i].target, up.arcs[i].weight);
+        }
+        template <typename F>
+        void forEachDownArc(V v, F&& fn) const {
+            for (std::size_t i = down.offsets[v]; i < down.offsets[v + 1]; i++) fn(down.arcs[i].target, down.arcs[i].weight);
+        }
+
+        // returns shortest distance from src to dest (INF if unreachable)
+        W query(V src, V dest) {
+            if (++epoch == 0) {
+                std::fill(fwd.reached.begin(), fwd.reached.end(), 0);
+                std::fill(bwd.reached.begin(), bwd.reached.end(), 0);
+                epoch = 1;
+            }
+            fwd.min_heap.clear();
+            bwd.min_heap.clear();
+            settled_count = 0;
+            mu = INF;
+            meet = -1;
+            relax(fwd, src, 0, -1);
+            relax(bwd, dest, 0, -1);
+            // each direction stops once its min key reaches mu (upward searches can't use the sum criterion)
+            while (true) {
+                bool f = !fwd.min_heap.empty() && fwd.min_heap.front().first < mu;
+                bool b = !bwd.min_heap.empty() && bwd.min_heap.front().first < mu;
+                if (!f && !b) break;
+                if (f && (!b || fwd.min_heap.front().first <= bwd.min_heap.front().first)) step(fwd, bwd, up);
+                else step(bwd, fwd, down);
+            }
+            return mu;
+        }
+
+        // vertices along shortest path found by last query, in the format constructShortestPath returns
+        std::vector<V> path() const {
+            std::vector<V> path;
+            if (meet == -1) return path;
+            std::vector<V> hierarchy_path = {meet};
+            for (V v = meet; fwd.bp[v] != -1; v = fwd.bp[v]) hierarchy_path.push_back(fwd.bp[v]);
+            std::reverse(hierarchy_path.begin(), hierarchy_path.end());
+            for (V v = meet; bwd.bp[v] != -1; v = bwd.bp[v]) hierarchy_path.push_back(bwd.bp[v]);
+            path.push_back(hierarchy_path[0]);
+            for (std::size_t i = 0; i + 1 < hierarchy_path.size(); i++)
+                unpack(hierarchy_path[i], hierarchy_path[i + 1], path);
+            return path;
+        }
+
+        /* writes hierarchy in binary format: magic, vertex & weight byte widths, n & arc counts, ranks, then for the
+        //   upward & downward graphs offsets followed by targets, weights & middles as separate arrays
+        //   - arcs are written field by field, so struct padding never reaches the file & equal hierarchies give equal files
+        */
+        void save(const std::string& path) const {
+            std::FILE* file = std::fopen(path.c_str(), "wb");
+            if (!file) throw std::runtime_error("failed to open " + path);
+            std::uint16_t widths[2] = {sizeof(V), sizeof(W)};
+            std::uint64_t header[4] = {std::is_floating_point<W>::value, n, up.arcs.size(), down.arcs.size()};
+            bool ok = std::fwrite("CH02", 1, 4, file) == 4 && std::fwrite(widths, sizeof(widths), 1, file) == 1
+                && std::fwrite(header, sizeof(header), 1, file) == 1 && std::fwrite(rank.data(), sizeof(V), n, file) == n;
+            for (const SearchGraph* sg : {&up, &down}) {
+                std::size_t m = sg->arcs.size();
+                std::vector<std::uint64_t> offsets(sg->offsets.begin(), sg->offsets.end());
+                std::vector<V> targets(m), middles(m);
+                std::vector<W> weights(m);
+                for (std::size_t i = 0; i < m; i++) {
+                    targets[i] = sg->arcs[i].target;
+                    weights[i] = sg->arcs[i].weight;
+                    middles[i] = sg->arcs[i].middle;
+                }
+                ok = ok && std::fwrite(offsets.data(), sizeof(std::uint64_t), n + 1, file) == n + 1
+                    && std::fwrite(targets.data(), sizeof(V), m, file) == m && std::fwrite(weights.data(), sizeof(W), m, file) == m
+                    && std::fwrite(middles.data(), sizeof(V), m, file) == m;
+            }
+            ok = std::fclose(file) == 0 && ok;
+            if (!ok) throw std::runtime_error("failed to write " + path);
+        }
+
+        /* loads hierarchy written by save
+        //   - throws std::runtime_error if the file can't be read, was written for other vertex / weight types or is not a
+        //     valid hierarchy (ranks not a permutation, offsets not non-decreasing up to the arc count, arcs pointing out of
+        //     range or not upward, shortcut middles not below both endpoints), so queries never read out of bounds
+        */
+        static ContractionHierarchy load(const std::string& path) {
+            std::FILE* file = std::fopen(path.c_str(), "rb");
+            if (!file) throw std::runtime_error("failed to open " + path);
+            ContractionHierarchy ch;
+            char magic[4];
+            std::uint16_t widths[2];
+            std::uint64_t header[4];
+            bool ok = std::fread(magic, 1, 4, file) == 4 && std::memcmp(magic, "CH02", 4) == 0
+                && std::fread(widths, sizeof(widths), 1, file) == 1 && std::fread(header, sizeof(header), 1, file) == 1;
+            if (ok && (widths[0] != sizeof(V) || widths[1] != sizeof(W) || header[0] != std::is_floating_point<W>::value)) {
+                std::fclose(file);
+                throw std::runtime_error("hierarchy file " + path + " does not match requested vertex / weight types");
+            }
+            if (ok) {
+                ch.n = header[1];
+                ch.rank.resize(ch.n);
+                ok = std::fread(ch.rank.data(), sizeof(V), ch.n, file) == ch.n;
+                SearchGraph* graphs[2] = {&ch.up, &ch.down};
+                for (int g = 0; g < 2 && ok; g++) {
+                    std::size_t m = header[2 + g];
+                    std::vector<std::uint64_t> offsets(ch.n + 1);
+                    std::vector<V> targets(m), middles(m);
+                    std::vector<W> weights(m);
+                    ok = std::fread(offsets.data(), sizeof(std::uint64_t), ch.n + 1, file) == ch.n + 1
+                        && std::fread(targets.data(), sizeof(V), m, file) == m && std::fread(weights.data(), sizeof(W), m, file) == m
+                        && std::fread(middles.data(), sizeof(V), m, file) == m;
+                    graphs[g]->offsets.assign(offsets.begin(), offsets.end());
+                    graphs[g]->arcs.resize(m);
+                    for (std::size_t i = 0; i < m && ok; i++) graphs[g]->arcs[i] = {targets[i], weights[i], middles[i]};
+                }
+                ok = ok && std::fgetc(file) == EOF && ch.valid();
+            }
+            std::fclose(file);
+            if (!ok) throw std::runtime_error("malformed hierarchy file " + path);
+            ch.resetSearch(ch.fwd);
+            ch.resetSearch(ch.bwd);
+            return ch;
+        }
+
+        // loads hierarchy written by save for graph, throws std::invalid_argument if it was built for a different vertex count
+        static ContractionHierarchy load(const std::string& path, const G& graph) {
+            ContractionHierarchy ch = load(path);
+            if (ch.n != graph.vertexCount())
+                throw std::invalid_argument("hierarchy " + path + " has " + std::to_string(ch.n) + " vertices, graph has "
+                                            + std::to_string(graph.vertexCount()));
+            return ch;
+        }
+};
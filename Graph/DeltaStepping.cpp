@@ -0,0 +1,55 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "DeltaStepping.h"
+#include "DijkstraEngine.h"
+
+typedef CSRGraph<int, double> graph_t;
+
+void benchmark(const std::string& name, const graph_t& graph) {
+    // starts from highest degree vertex so search reaches giant component of power-law graphs
+    int src = 0;
+    for (std::size_t v = 0; v < graph.vertexCount(); v++)
+        if (graph.degree(v) > graph.degree(src)) src = v;
+    DijkstraEngine<graph_t> dijkstra(graph);
+    auto start = std::chrono::steady_clock::now();
+    dijkstra.run(src);
+    double base = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << '\n' << name << " (n = " << graph.vertexCount() << ", m = " << graph.edgeCount() << ", delta = " << tuneDelta(graph)
+              << "), dijkstra: " << base << " ms\n" << std::left << std::setw(10) << "threads" << std::setw(16) << "time (ms)"
+              << std::setw(16) << "speedup" << "matches" << '\n';
+    for (unsigned threads : {1, 2, 4, 8, 16, 32}) {
+        start = std::chrono::steady_clock::now();
+        std::vector<double> dist = deltaStepping(graph, src, 0.0, threads);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        bool match = true;
+        for (std::size_t v = 0; v < graph.vertexCount(); v++)
+            if (dist[v] != dijkstra.distance(v)) match = false;
+        std::cout << std::setw(10) << threads << std::setw(16) << ms << std::setw(16) << base / ms << (match ? "yes" : "no") << '\n';
+    }
+}
+
+// sample test case & thread scaling benchmark for delta stepping
+int main() {
+    int src = 1, n = 5;
+    std::vector<edge> edges = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, 5}, {0, 4, 5}};
+    std::vector<double> dist = deltaStepping(edges, n, src, 2.0);
+    std::cout << std::left << std::setw(10) << "Vertex" << std::setw(10) << "Dist. from src" << '\n';
+    for (int i = 0; i < n; i++) {
+        if (i == src) continue;
+        if (dist[i] == DijkstraEngine<graph_t>::INF)
+            std::cout << std::setw(10) << i << std::setw(10) << "+INF" << '\n';
+        else
+            std::cout << std::setw(10) << i << std::setw(10) << dist[i] << '\n';
+    }
+    try {
+        deltaStepping(std::vector<edge>{{0, 1, 2}, {1, 2, -1}}, 3, 0, 2.0);
+    } catch (const std::invalid_argument& e) {
+        std::cout << "explicit delta, negative edge rejected: " << e.what() << '\n';
+    }
+
+    benchmark("random", graph_t(erdosRenyiGraph(1 << 20, 8 << 20, 42), 1 << 20));
+    benchmark("power-law", graph_t(rmatGraph(20, 8 << 20, 42), 1 << 20));
+    return 0;
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include <limits>
+#include <vector>
+#include <stdexcept>
+#include "Graph.h"
+
+// picks bucket width from weight distribution: max weight / average out-degree (meyer & sanders), at least min weight
+template <typename G>
+typename G::weight_type tuneDelta(const G& graph) {
+    typedef typename G::weight_type W;
+    const auto& weights = graph.weightArray();
+    if (weights.empty()) return 1;
+    W mx = 0, mn = std::numeric_limits<W>::max();
+    for (W w : weights) {
+        if (w < 0) throw std::invalid_argument("delta stepping requires non-negative edge weights");
+        mx = std::max(mx, w);
+        if (w > 0) mn = std::min(mn, w);
+    }
+    if (mx == 0) return 1;
+    double avg_degree = (double) graph.edgeCount() / std::max<std::size_t>(1, graph.vertexCount());
+    return std::max<W>(mn, (W) (mx / std::max(1.0, avg_degree)));
+}
+
+/* parallel delta stepping - single source shortest paths with non-negative weights
+//   - tentative distances are grouped into buckets of width delta, bucket i holds distances in [i * delta, (i + 1) * delta)
+//   - light edges (weight <= delta) may reinsert vertices into the current bucket, so they are relaxed repeatedly
+//     until the bucket is empty; heavy edges only reach later buckets, so they are relaxed once per settled vertex
+//   - vertices of each phase are relaxed in parallel, distances are lowered with an atomic min
+//   - delta = min weight behaves like dijkstra's, delta = infinity like bellman ford
+// note: throws std::invalid_argument if any edge weight is negative, whatever delta is passed
+// @params
+//   - graph: csr graph, src: id of source vertex, delta: bucket width (0 = tune from weights), threads: worker count
+*/
+template <typename G>
+std::vector<typename G::weight_type> deltaStepping(const G& graph, typename G::vertex_type src, typename G::weight_type delta = 0,
+                                                   unsigned threads = defaultThreads()) {
+    typedef typename G::vertex_type V;
+    typedef typename G::weight_type W;
+    const W INF = std::numeric_limits<W>::max();
+    std::size_t n = graph.vertexCount();
+    // negative distances would map to negative bucket indices, so they are rejected before any bucket is built
+    for (W w : graph.weightArray())
+        if (w < 0) throw std::invalid_argument("delta stepping requires non-negative edge weights");
+    if (delta <= 0) delta = tuneDelta(graph);
+
+    std::vector<std::atomic<W>> dist(n);
+    for (auto& d : dist) d.store(INF, std::memory_order_relaxed);
+    dist[src].store(0, std::memory_order_relaxed);
+    auto bucketOf = [&](V v) { return (std::size_t) (dist[v].load(std::memory_order_relaxed) / delta); };
+
+    std::vector<std::vector<V>> buckets(1, std::vector<V>{src});
+    std::vector<std::size_t> in_bucket(n, 0); // bucket index + 1 a vertex is currently queued in (0 = none)
+    std::vector<std::size_t> settled_in(n, 0); // bucket index + 1 a vertex was settled in
+    std::vector<std::vector<V>> local(threads); // per-thread vertices whose distance improved
+    in_bucket[src] = 1;
+
+    // relaxes light or heavy out-edges of every vertex in frontier in parallel
+    auto relaxAll = [&](const std::vector<V>& frontier, bool light) {
+        parallelFor(0, frontier.size(), [&](unsigned t, std::size_t lo, std::size_t hi) {
+            for (std::size_t i = lo; i < hi; i++) {
+                V curr = frontier[i];
+                W d = dist[curr].load(std::memory_order_relaxed);
+                for (auto [next, weight] : graph.neighbors(curr)) {
+                    if ((weight <= delta) != light) continue;
+                    if (atomicMin(dist[next], d + weight)) local[t].push_back(next);
+                }
+            }
+        }, threads, 256);
+        // moves improved vertices into bucket of their new distance
+        for (auto& list : local) {
+            for (V v : list) {
+                std::size_t b = bucketOf(v);
+                if (in_bucket[v] == b + 1) continue;
+                in_bucket[v] = b + 1;
+                if (b >= buckets.size()) buckets.resize(b + 1);
+                buckets[b].push_back(v);
+            }
+            list.clear();
+        }
+    };
+
+    std::vector<V> frontier, settled;
+    for (std::size_t i = 0; i < buckets.size(); i++) {
+        settled.clear();
+        while (!buckets[i].empty()) {
+            frontier.clear();
+            for (V v : buckets[i]) {
+                if (in_bucket[v] != i + 1) continue;
+                in_bucket[v] = 0;
+                frontier.push_back(v);
+                if (settled_in[v] != i + 1) {
+                    settled_in[v] = i + 1;
+                    settled.push_back(v);
+                }
+            }
+            buckets[i].clear();
+            relaxAll(frontier, true);
+        }
+        relaxAll(settled, false);
+        std::vector<V>().swap(buckets[i]);
+    }
+
+    std::vector<W> result(n);
+    for (std::size_t v = 0; v < n; v++) result[v] = dist[v].load(std::memory_order_relaxed);
+    return result;
+}
+
+// delta stepping directly from edge set (same input as dijkstra's & bellman ford samples)
+inline std::vector<double> deltaStepping(const std::vector<edge>& edges, int n, int src, double delta = 0, unsigned threads = defaultThreads()) {
+    return deltaStepping(CSRGraph<int, double>(edges, n, threads), src, delta, threads);
+}
@@ -0,0 +1,106 @@
+#include <queue>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <iomanip>
+#include <iostream>
+#include "DijkstraEngine.h"
+
+typedef CSRGraph<int, double> graph_t;
+
+// baseline: allocates fresh arrays & runs every query to completion
+double freshDijkstras(const graph_t& graph, int src, int dest) {
+    typedef std::pair<double, int> pdi;
+    std::vector<double> dist(graph.vertexCount(), DijkstraEngine<graph_t>::INF);
+    std::vector<bool> vis(graph.vertexCount(), false);
+    std::priority_queue<pdi, std::vector<pdi>, std::greater<pdi>> min_heap;
+    dist[src] = 0;
+    min_heap.push({0, src});
+    while (!min_heap.empty()) {
+        int curr = min_heap.top().second; min_heap.pop();
+        if (vis[curr]) continue;
+        vis[curr] = true;
+        for (auto [next, weight] : graph.neighbors(curr)) {
+            if (dist[curr] + weight < dist[next]) {
+                dist[next] = dist[curr] + weight;
+                min_heap.push({dist[next], next});
+            }
+        }
+    }
+    return dist[dest];
+}
+
+// road-like graph: side x side bidirectional grid with random weights
+graph_t makeGrid(int side, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<edge> edges;
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) { edges.push_back({u, u + 1, (double) (rng() % 100 + 1)}); edges.push_back({u + 1, u, (double) (rng() % 100 + 1)}); }
+            if (r + 1 < side) { edges.push_back({u, u + side, (double) (rng() % 100 + 1)}); edges.push_back({u + side, u, (double) (rng() % 100 + 1)}); }
+        }
+    }
+    return graph_t(edges, side * side);
+}
+
+// sample test case & benchmark for reusable dijkstra's engine
+int main() {
+    std::vector<edge> edges = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, 5}, {0, 4, 5}};
+    graph_t graph(edges, 5);
+    DijkstraEngine<graph_t> engine(graph);
+    // repeated queries reuse the same engine without stale results
+    for (int src : {1, 0, 1}) {
+        engine.run(src);
+        std::cout << "src " << src << ":";
+        for (int v = 0; v < 5; v++) {
+            if (engine.isSettled(v)) std::cout << ' ' << engine.distance(v);
+            else std::cout << " +INF";
+        }
+        std::cout << '\n';
+    }
+    std::cout << "Vertex 1 to 4 (early exit): " << engine.runTo(1, 4) << ", path:";
+    for (int v : engine.path(4)) std::cout << ' ' << v;
+    std::cout << '\n';
+
+    // point-to-point queries on a road-like grid
+    const int side = 500, queries = 100;
+    graph_t grid = makeGrid(side, 42);
+    std::mt19937 rng(7);
+    std::vector<std::pair<int, int>> pairs(queries);
+    for (auto& [s, t] : pairs) { s = rng() % (side * side); t = rng() % (side * side); }
+
+    auto start = std::chrono::steady_clock::now();
+    double sum1 = 0;
+    for (auto [s, t] : pairs) sum1 += freshDijkstras(grid, s, t);
+    double t1 = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    DijkstraEngine<graph_t> grid_engine(grid);
+    double sum2 = 0;
+    for (auto [s, t] : pairs) sum2 += grid_engine.runTo(s, t);
+    double t2 = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // each thread owns its own engine over the shared graph
+    start = std::chrono::steady_clock::now();
+    unsigned threads = defaultThreads();
+    std::vector<double> sums(threads, 0);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            DijkstraEngine<graph_t> local(grid);
+            for (std::size_t i = t; i < pairs.size(); i += threads)
+                sums[t] += local.runTo(pairs[i].first, pairs[i].second);
+        });
+    }
+    for (auto& w : workers) w.join();
+    double t3 = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    double sum3 = 0;
+    for (double s : sums) sum3 += s;
+
+    if (sum1 != sum2 || sum1 != sum3) std::cout << "distance mismatch!\n";
+    std::cout << '\n' << std::left << std::setw(28) << "fresh full query (ms/q)" << std::setw(28) << "engine early exit (ms/q)"
+              << "engine x " << threads << " threads (ms/q)" << '\n';
+    std::cout << std::setw(28) << t1 / queries << std::setw(28) << t2 / queries << t3 / queries << '\n';
+    return 0;
+}
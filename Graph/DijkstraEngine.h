@@ -0,0 +1,136 @@
+#pragma once
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include "Graph.h"
+#include "PriorityQueues.h"
+
+/* reusable dijkstra's query engine - time complexity O((E + V) * log V) per query, O(touched) reset between queries
+//   - owns its distance, back pointer & heap storage, which are reused across queries
+//   - every vertex carries an epoch stamp: data of vertices not stamped with current query's epoch is treated as unset
+//   - supports early exit once a single target or a set of targets is settled, and a bound on settled distances
+// note: an engine is not thread-safe, but engines sharing one (read-only) graph can run concurrently, one per thread
+// @template
+//   - G: graph type providing vertexCount() & neighbors(v) (e.g. CSRGraph)
+//   - Q: priority queue policy from PriorityQueues.h (lazy or addressable heap, integer radix or bucket queue)
+*/
+template <typename G, template <typename, typename> class Q = LazyHeap>
+class DijkstraEngine {
+    public:
+        typedef typename G::vertex_type V;
+        typedef typename G::weight_type W;
+
+        static constexpr W INF = std::numeric_limits<W>::max();
+
+    private:
+        typedef Q<V, W> queue_type;
+        static_assert(detail::QueueConstructible<queue_type, G>::value, "queue policy must be constructible from const G&");
+        static_assert(detail::QueuePush<queue_type, V, W>::value, "queue policy must provide push(V vertex, W key)");
+        static_assert(detail::QueuePop<queue_type, V, W>::value, "queue policy must provide pop() returning a {key, vertex} pair");
+        static_assert(detail::QueueEmpty<queue_type>::value, "queue policy must provide empty() const returning bool");
+        static_assert(detail::QueueClear<queue_type>::value, "queue policy must provide clear()");
+
+        const G* graph;
+        std::vector<W> dist; // tracks distances from source vertex
+        std::vector<V> bp; // tracks back pointer for vertices (for path reconstruction)
+        std::vector<std::uint32_t> reached; // epoch in which vertex was last reached
+        std::vector<std::uint32_t> settled; // epoch in which vertex was last settled
+        std::vector<std::uint32_t> target; // epoch in which vertex was last marked as a target
+        queue_type queue;
+        std::uint32_t epoch;
+        std::size_t settled_count;
+
+        // starts new query, clearing stamps only when the epoch counter wraps around
+        void nextEpoch() {
+            if (++epoch == 0) {
+                std::fill(reached.begin(), reached.end(), 0);
+                std::fill(settled.begin(), settled.end(), 0);
+                std::fill(target.begin(), target.end(), 0);
+                epoch = 1;
+            }
+            queue.clear();
+            settled_count = 0;
+        }
+
+        void relax(V v, W d, V prev) {
+            if (reached[v] == epoch && d >= dist[v]) return;
+            reached[v] = epoch;
+            dist[v] = d;
+            bp[v] = prev;
+            queue.push(v, d);
+        }
+
+        // settles vertices in order of distance until heap is empty, remaining targets are settled or bound is exceeded
+        void search(std::size_t remaining, W bound) {
+            while (!queue.empty()) {
+                auto [d, curr] = queue.pop();
+                if (settled[curr] == epoch || d != dist[curr]) continue;
+                if (d > bound) break;
+                settled[curr] = epoch;
+                settled_count++;
+                if (target[curr] == epoch && --remaining == 0) break;
+                for (auto [next, weight] : graph->neighbors(curr)) {
+                    if (settled[next] == epoch) continue;
+                    relax(next, d + weight, curr);
+                }
+            }
+        }
+
+    public:
+        DijkstraEngine(const G& p_graph)
+            : graph(&p_graph), dist(p_graph.vertexCount()), bp(p_graph.vertexCount()), reached(p_graph.vertexCount(), 0),
+              settled(p_graph.vertexCount(), 0), target(p_graph.vertexCount(), 0), queue(p_graph), epoch(0), settled_count(0) {}
+
+        // full single source query
+        void run(V src) { runBounded(src, INF); }
+
+        // single source query that stops after settling every vertex within bound
+        // note: separate name from runTo, since run(src, dest) & run(src, bound) collide when V == W
+        void runBounded(V src, W bound) {
+            nextEpoch();
+            relax(src, 0, -1);
+            search(0, bound);
+        }
+
+        // stops as soon as dest is settled, returns distance to dest (INF if unreachable within bound)
+        W runTo(V src, V dest, W bound = INF) {
+            nextEpoch();
+            target[dest] = epoch;
+            relax(src, 0, -1);
+            search(1, bound);
+            return distance(dest);
+        }
+
+        // stops as soon as every target is settled
+        void runTo(V src, const std::vector<V>& targets, W bound = INF) {
+            nextEpoch();
+            std::size_t remaining = 0;
+            for (V t : targets) {
+                if (target[t] == epoch) continue;
+                target[t] = epoch;
+                remaining++;
+            }
+            relax(src, 0, -1);
+            if (remaining) search(remaining, bound);
+        }
+
+        // distance of settled vertex from source of last query (INF if it was not settled)
+        W distance(V v) const { return settled[v] == epoch ? dist[v] : INF; }
+        bool isSettled(V v) const { return settled[v] == epoch; }
+        // back pointer of settled vertex (-1 for source or vertices not settled)
+        V parent(V v) const { return settled[v] == epoch ? bp[v] : -1; }
+        std::size_t settledCount() const { return settled_count; }
+        const G& getGraph() const { return *graph; }
+
+        // reconstructs shortest cost path from source vertex of last query to dest (empty if dest was not settled)
+        std::vector<V> path(V dest) const {
+            std::vector<V> path;
+            if (settled[dest] != epoch) return path;
+            for (V v = dest; v != -1; v = bp[v])
+                path.push_back(v);
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+};
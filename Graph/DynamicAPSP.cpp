@@ -0,0 +1,109 @@
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "DynamicAPSP.h"
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// current edge set of dynamic structure (one edge per vertex pair)
+std::vector<edge> currentEdges(const DynamicAPSP& apsp) {
+    std::vector<edge> edges;
+    int n = apsp.size();
+    for (int u = 0; u < n; u++)
+        for (int v = 0; v < n; v++)
+            if (apsp.edgeWeight(u, v) != INT_MAX) edges.push_back({u, v, (double) apsp.edgeWeight(u, v)});
+    return edges;
+}
+
+// compares distances with a full floyd warshall run & checks that every forward pointer path has the reported cost
+std::size_t verify(const DynamicAPSP& apsp) {
+    int n = apsp.size();
+    BlockedFloydWarshall full(currentEdges(apsp), n);
+    full.run();
+    std::size_t errors = 0;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (apsp.distance(i, j) != full.distance(i, j)) { errors++; continue; }
+            std::vector<int> path = apsp.path(i, j);
+            if (path.empty()) continue;
+            long long cost = 0;
+            for (std::size_t k = 1; k < path.size(); k++) cost += apsp.edgeWeight(path[k - 1], path[k]);
+            if (path.back() != j || cost != apsp.distance(i, j)) errors++;
+        }
+    }
+    return errors;
+}
+
+// sample test case & verification / benchmark for dynamic all pairs shortest paths
+int main() {
+    int n = 5;
+    std::vector<edge> edges = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, -2}, {0, 4, 9}};
+    DynamicAPSP apsp(edges, n);
+    auto printPath = [&](int src, int dest) {
+        std::vector<int> path = apsp.path(src, dest);
+        std::cout << "Vertex " << src << " to " << dest << " (cost " << apsp.distance(src, dest) << "): " << path[0];
+        for (std::size_t i = 1; i < path.size(); i++) std::cout << " -> " << path[i];
+        std::cout << '\n';
+    };
+    printPath(0, 4);
+    apsp.setEdge(0, 3, -1);
+    std::cout << "after inserting 0 -> 3 (-1): ";
+    printPath(0, 4);
+    apsp.removeEdge(0, 3);
+    apsp.setEdge(2, 3, 5);
+    std::cout << "after removing 0 -> 3 & raising 2 -> 3 to 5: ";
+    printPath(0, 4);
+    try {
+        apsp.setEdge(4, 0, -10);
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Rejected 4 -> 0 (-10): " << e.what() << '\n';
+    }
+
+    // random batches on a graph with negative weights; potentials keep every cycle non-negative
+    const int size = 1024;
+    std::mt19937 rng(7);
+    std::vector<int> p(size);
+    for (auto& x : p) x = rng() % 50;
+    auto shifted = [&](int u, int v, int base) { return edge(u, v, base + p[u] - p[v]); };
+    std::vector<edge> random;
+    for (const auto& e : erdosRenyiGraph(size, 8 * size, 42, 1, 100)) random.push_back(shifted(e.from, e.to, e.weight));
+    auto start = std::chrono::steady_clock::now();
+    DynamicAPSP dynamic(random, size);
+    double full_ms = elapsed(start);
+    std::cout << "\nn = " << size << ", m = " << random.size() << ", initial floyd warshall: " << full_ms << " ms\n" << std::left
+              << std::setw(28) << "batch" << std::setw(14) << "time (ms)" << std::setw(18) << "rows recomputed" << "errors" << '\n';
+    auto batch = [&](const std::string& name, const std::vector<edge>& changes) {
+        std::size_t rows = dynamic.recomputedRows();
+        start = std::chrono::steady_clock::now();
+        dynamic.update(changes);
+        double ms = elapsed(start);
+        std::cout << std::setw(28) << name << std::setw(14) << ms << std::setw(18) << dynamic.recomputedRows() - rows << verify(dynamic) << '\n';
+    };
+    std::vector<edge> changes;
+    for (int i = 0; i < 10; i++) changes.push_back(shifted(rng() % size, rng() % size, 1));
+    batch("10 insertions", changes);
+    changes.clear();
+    std::vector<edge> current = currentEdges(dynamic);
+    for (int i = 0; i < 10; i++) {
+        const edge& e = current[rng() % current.size()];
+        changes.push_back(shifted(e.from, e.to, 200));
+    }
+    batch("10 increases", changes);
+    changes.clear();
+    for (int i = 0; i < 10; i++) {
+        const edge& e = current[rng() % current.size()];
+        changes.push_back(edge(e.from, e.to, DynamicAPSP::INF));
+    }
+    batch("10 deletions", changes);
+    changes.clear();
+    for (int i = 0; i < 100; i++) {
+        int u = rng() % size, v = rng() % size;
+        changes.push_back(shifted(u, v, rng() % 2 ? 1 : 150));
+    }
+    batch("100 mixed updates", changes);
+    return 0;
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include <vector>
+#include <climits>
+#include <stdexcept>
+#include <algorithm>
+#include "Graph.h"
+#include "DijkstraEngine.h"
+#include "BlockedFloydWarshall.h"
+
+/* dynamic all pairs shortest paths - keeps the floyd warshall distance & forward pointer matrices exact under edge updates
+//   - decrease / insertion of u -> v: O(V^2), every pair i, j is relaxed through the new edge: dist[i][u] + w + dist[v][j]
+//   - increase / deletion: only rows with a shortest path through u -> v can change; a row is affected if some j with
+//     next[u][j] == v satisfies dist[i][u] + dist[u][j] == dist[i][j], those rows are recomputed with dijkstra's
+//   - dijkstra's runs on reduced weights w + h(x) - h(y), with h(y) = min over i of dist[i][y] taken before the batch
+//     (distances from a virtual source, as in johnson's), which stay non-negative when weights only grow
+//   - a batch first applies all increases (one recomputation of the union of affected rows), then each decrease
+// note: parallel edges aren't kept, each vertex pair holds one weight (like adj_matrix in FloydWarshall.cpp); throws
+//       std::invalid_argument if a decrease would close a negative cycle, updates before it in the batch stay applied
+*/
+class DynamicAPSP {
+    public:
+        static constexpr int INF = BlockedFloydWarshall::INF;
+
+    private:
+        std::size_t n;
+        unsigned threads;
+        std::vector<int> weight; // n x n edge weights (INF if no edge)
+        std::vector<int> dist; // n x n shortest path costs
+        std::vector<int> next; // n x n forward pointers (-1 if no path or i == j)
+        std::size_t recomputed_rows = 0;
+
+        std::size_t at(std::size_t i, std::size_t j) const { return i * n + j; }
+
+        void decrease(int u, int v, int w) {
+            if (w + std::min(dist[at(v, u)], INF) < 0) throw std::invalid_argument("edge update would create a negative cycle");
+            weight[at(u, v)] = w;
+            if (u == v) return;
+            for (std::size_t i = 0; i < n; i++) {
+                int du = dist[at(i, u)];
+                if (du >= INF / 2) continue;
+                int base = du + w, hop = (int) i == u ? v : next[at(i, u)];
+                const int* vrow = &dist[at(v, 0)];
+                int* irow = &dist[at(i, 0)];
+                for (std::size_t j = 0; j < n; j++) {
+                    if (vrow[j] >= INF / 2 || base + vrow[j] >= irow[j]) continue;
+                    irow[j] = base + vrow[j];
+                    next[at(i, j)] = hop;
+                }
+            }
+        }
+
+        // dijkstra's from src on reduced weights, rewrites row src of dist & next
+        void recomputeRow(int src, const std::vector<int>& h, DijkstraEngine<CSRGraph<int, int>>& engine, std::vector<int>& first) {
+            engine.run(src);
+            std::fill(first.begin(), first.end(), -2);
+            std::vector<int> stack;
+            for (std::size_t v = 0; v < n; v++) {
+                if (!engine.isSettled(v)) {
+                    dist[at(src, v)] = INF;
+                    next[at(src, v)] = -1;
+                    continue;
+                }
+                // first hop is shared with the parent, so walk up until a known vertex & fill in on the way down
+                int x = v;
+                while (x != src && first[x] == -2 && engine.parent(x) != src) {
+                    stack.push_back(x);
+                    x = engine.parent(x);
+                }
+                int hop = x == src ? -1 : first[x] != -2 ? first[x] : x;
+                if (x != src) first[x] = hop;
+                for (; !stack.empty(); stack.pop_back()) first[stack.back()] = hop;
+                dist[at(src, v)] = engine.distance(v) - h[src] + h[v];
+                next[at(src, v)] = first[v] == -2 ? -1 : first[v];
+            }
+        }
+
+        void increase(const std::vector<edge>& changes) {
+            // potentials of graph before increases
+            std::vector<int> h(n, 0);
+            for (std::size_t i = 0; i < n; i++)
+                for (std::size_t j = 0; j < n; j++)
+                    h[j] = std::min(h[j], dist[at(i, j)]);
+            std::vector<bool> affected(n, false);
+            std::vector<std::size_t> via;
+            for (const auto& e : changes) {
+                int u = e.from, v = e.to;
+                via.clear();
+                for (std::size_t j = 0; j < n; j++)
+                    if (next[at(u, j)] == v) via.push_back(j);
+                for (std::size_t i = 0; i < n && !via.empty(); i++) {
+                    int du = dist[at(i, u)];
+                    if (affected[i] || du >= INF / 2) continue;
+                    for (std::size_t j : via) {
+                        if (du + dist[at(u, j)] != dist[at(i, j)]) continue;
+                        affected[i] = true;
+                        break;
+                    }
+                }
+            }
+            for (const auto& e : changes) weight[at(e.from, e.to)] = e.weight >= INF / 2 ? INF : (int) e.weight;
+            std::vector<int> rows;
+            for (std::size_t i = 0; i < n; i++)
+                if (affected[i]) rows.push_back(i);
+            recomputed_rows += rows.size();
+            if (rows.empty()) return;
+            struct arc { int from, to, weight; };
+            std::vector<arc> reduced;
+            for (std::size_t u = 0; u < n; u++)
+                for (std::size_t v = 0; v < n; v++)
+                    if (u != v && weight[at(u, v)] < INF / 2) reduced.push_back({(int) u, (int) v, weight[at(u, v)] + h[u] - h[v]});
+            CSRGraph<int, int> graph(reduced, n, threads);
+            parallelFor(0, rows.size(), [&](unsigned, std::size_t lo, std::size_t hi) {
+                DijkstraEngine<CSRGraph<int, int>> engine(graph);
+                std::vector<int> first(n);
+                for (std::size_t r = lo; r < hi; r++) recomputeRow(rows[r], h, engine, first);
+            }, threads, 8);
+        }
+
+    public:
+        // runs blocked floyd warshall once on initial edge set
+        DynamicAPSP(const std::vector<edge>& edges, int p_n, unsigned p_threads = defaultThreads())
+            : n(p_n), threads(p_threads), weight((std::size_t) p_n * p_n, INF), dist((std::size_t) p_n * p_n), next((std::size_t) p_n * p_n) {
+            for (const auto& e : edges) weight[at(e.from, e.to)] = std::min(weight[at(e.from, e.to)], (int) e.weight);
+            BlockedFloydWarshall fw(edges, p_n, true);
+            fw.run(threads);
+            if (fw.hasNegativeCycle()) throw std::invalid_argument("graph contains a negative cycle");
+            std::size_t stride = fw.rowStride();
+            for (std::size_t i = 0; i < n; i++) {
+                std::copy_n(fw.distanceMatrix().begin() + i * stride, n, dist.begin() + at(i, 0));
+                std::copy_n(fw.nextMatrix().begin() + i * stride, n, next.begin() + at(i, 0));
+            }
+            for (int& d : dist) if (d >= INF / 2) d = INF;
+        }
+
+        /* applies a batch of edge weight changes (weight >= INF / 2 deletes the edge)
+        //   - increases & deletions share one recomputation of affected rows, decreases are O(V^2) each
+        */
+        void update(const std::vector<edge>& changes) {
+            std::vector<edge> increases, decreases;
+            for (const auto& e : changes) {
+                int w = e.weight >= INF / 2 ? INF : (int) e.weight;
+                if (w > weight[at(e.from, e.to)]) increases.push_back(e);
+                else if (w < weight[at(e.from, e.to)]) decreases.push_back(e);
+            }
+            if (!increases.empty()) increase(increases);
+            for (const auto& e : decreases) decrease(e.from, e.to, (int) e.weight);
+        }
+
+        void setEdge(int u, int v, int w) { update({edge(u, v, w)}); }
+        void removeEdge(int u, int v) { update({edge(u, v, INF)}); }
+
+        std::size_t size() const { return n; }
+        // total # of rows recomputed by increases & deletions so far
+        std::size_t recomputedRows() const { return recomputed_rows; }
+
+        // weight of edge u -> v (INT_MAX if there is none)
+        int edgeWeight(int u, int v) const { return weight[at(u, v)] >= INF / 2 ? INT_MAX : weight[at(u, v)]; }
+
+        // shortest path cost from i to j (INT_MAX if unreachable)
+        int distance(int i, int j) const { return dist[at(i, j)] >= INF / 2 ? INT_MAX : dist[at(i, j)]; }
+
+        // vertices traversed along shortest path from src to dest (empty if dest is unreachable)
+        std::vector<int> path(int src, int dest) const {
+            std::vector<int> path;
+            if (distance(src, dest) == INT_MAX) return path;
+            path.push_back(src);
+            for (int v = next[at(src, dest)]; v != -1; v = next[at(v, dest)])
+                path.push_back(v);
+            return path;
+        }
+};
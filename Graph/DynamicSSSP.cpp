@@ -0,0 +1,115 @@
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "DynamicSSSP.h"
+#include "DijkstraEngine.h"
+
+typedef DynamicSSSP<long long> sssp_t;
+typedef CSRGraph<int, long long> graph_t;
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// current edge set of dynamic structure
+std::vector<edge> currentEdges(const sssp_t& sssp) {
+    std::vector<edge> edges;
+    for (int u = 0; u < (int) sssp.size(); u++)
+        for (auto [v, w] : sssp.neighbors(u)) edges.push_back({u, v, (double) w});
+    return edges;
+}
+
+// compares distances with a full dijkstra's run & checks every back pointer is a tight edge, returns # of errors
+std::size_t verify(const sssp_t& sssp, double& full_ms) {
+    int n = sssp.size();
+    graph_t graph(currentEdges(sssp), n);
+    DijkstraEngine<graph_t> engine(graph);
+    auto start = std::chrono::steady_clock::now();
+    engine.run(sssp.source());
+    full_ms = elapsed(start);
+    std::size_t errors = 0;
+    for (int v = 0; v < n; v++) {
+        if (sssp.distance(v) != engine.distance(v)) { errors++; continue; }
+        int p = sssp.parent(v);
+        if (p != -1 && sssp.distance(p) + sssp.edgeWeight(p, v) != sssp.distance(v)) errors++;
+    }
+    return errors;
+}
+
+// random batch: 40% increases, 30% decreases, 15% deletions, 15% insertions
+std::vector<edge> randomBatch(const sssp_t& sssp, std::size_t size, std::mt19937_64& rng) {
+    int n = sssp.size();
+    std::vector<edge> batch;
+    while (batch.size() < size) {
+        int u = rng() % n, kind = rng() % 100;
+        const auto& out = sssp.neighbors(u);
+        if (kind >= 85) {
+            batch.push_back({u, (int) (rng() % n), (double) (1 + rng() % 1000)});
+            continue;
+        }
+        if (out.empty()) continue;
+        auto [v, w] = out[rng() % out.size()];
+        if (kind < 40) batch.push_back({u, v, (double) (w + 1 + rng() % 500)});
+        else if (kind < 70) batch.push_back({u, v, (double) (rng() % (w + 1))});
+        else batch.push_back({u, v, (double) sssp_t::INF});
+    }
+    return batch;
+}
+
+// sample test case & verification / benchmark of dynamic sssp repair vs full recomputation
+int main() {
+    std::vector<edge> edges = {{0, 1, 4}, {0, 2, 1}, {2, 1, 2}, {1, 3, 1}, {2, 3, 5}, {3, 4, 3}};
+    sssp_t sample(edges, 5, 0);
+    auto printPath = [&](int dest) {
+        std::vector<int> path = sample.path(dest);
+        std::cout << "Vertex 0 to " << dest << " (cost " << sample.distance(dest) << "): " << path[0];
+        for (std::size_t i = 1; i < path.size(); i++) std::cout << " -> " << path[i];
+        std::cout << '\n';
+    };
+    printPath(4);
+    sample.setEdge(2, 1, 10);
+    std::cout << "after raising 2 -> 1 to 10: ";
+    printPath(4);
+    sample.update({edge(0, 3, 2), edge(0, 1, 1)});
+    std::cout << "after inserting 0 -> 3 (2) & lowering 0 -> 1 to 1: ";
+    printPath(4);
+    sample.removeEdge(0, 3);
+    std::cout << "after removing 0 -> 3: ";
+    printPath(4);
+
+    std::mt19937_64 rng(11);
+    std::vector<std::pair<std::string, std::pair<std::vector<edge>, int>>> families;
+    families.push_back({"grid 700x700", {gridGraph(700, 42, 1, 1000), 700 * 700}});
+    families.push_back({"geometric 500K", {geometricGraph(500000, 4, 42, 1000), 500000}});
+    families.push_back({"r-mat 2^19", {rmatGraph(19, 4ull << 19, 42, 1, 1000), 1 << 19}});
+    std::cout << '\n' << std::left << std::setw(16) << "graph" << std::setw(8) << "batch" << std::setw(16) << "repair (ms)" << std::setw(14)
+              << "full (ms)" << std::setw(12) << "speedup" << std::setw(14) << "affected" << std::setw(14) << "settled" << "errors" << '\n';
+    for (auto& [name, input] : families) {
+        // source with most out-edges, so it reaches the bulk of the graph
+        std::vector<int> degree(input.second, 0);
+        for (const auto& e : input.first) degree[e.from]++;
+        int src = std::max_element(degree.begin(), degree.end()) - degree.begin();
+        sssp_t sssp(input.first, input.second, src);
+        for (std::size_t size : {1, 10, 100, 1000}) {
+            const int batches = 10;
+            double repair_ms = 0, full_ms = 0;
+            std::size_t affected = 0, settled = 0, errors = 0;
+            for (int b = 0; b < batches; b++) {
+                std::vector<edge> batch = randomBatch(sssp, size, rng);
+                auto start = std::chrono::steady_clock::now();
+                sssp.update(batch);
+                repair_ms += elapsed(start);
+                affected += sssp.affectedCount();
+                settled += sssp.settledCount();
+                double ms;
+                errors += verify(sssp, ms);
+                full_ms += ms;
+            }
+            std::cout << std::setw(16) << name << std::setw(8) << size << std::setw(16) << repair_ms / batches << std::setw(14) << full_ms / batches
+                      << std::setw(12) << full_ms / repair_ms << std::setw(14) << affected / batches << std::setw(14) << settled / batches << errors << '\n';
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,183 @@
+#pragma once
+#include <limits>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include "Graph.h"
+
+/* dynamic single source shortest paths (ramalingam & reps style) - keeps dist & back pointer tree bp exact under
+// batches of edge insertions, deletions & weight changes, repairing only the part of the tree that can change
+//   - increase / deletion of a tree edge u -> v (bp[v] == u): v's whole subtree loses its distance; every invalidated
+//     vertex gets a tentative distance from its valid in-neighbors (the boundary) & is queued
+//   - decrease / insertion of u -> v: if dist[u] + w < dist[v], v is lowered & queued
+//   - one dijkstra's from all queued vertices then settles invalidated vertices & propagates decreases; it stops as
+//     soon as the queue is empty, so unaffected parts of the graph are never scanned
+//   - non-tree edges that increase or disappear change nothing
+// note: weights must be non-negative (throws std::invalid_argument), each vertex pair holds one edge (like
+//       DynamicAPSP), adjacency is kept as per-vertex out & in lists so edges can be added & removed cheaply
+// @template
+//   - W: edge weight type
+*/
+template <typename W = double>
+class DynamicSSSP {
+    public:
+        typedef int V;
+
+        static constexpr W INF = std::numeric_limits<W>::max();
+
+    private:
+        typedef std::pair<W, V> entry;
+
+        std::size_t n;
+        V src;
+        std::vector<std::vector<std::pair<V, W>>> out, in; // out[u] = {v, w}, in[v] = {u, w}
+        std::vector<W> dist;
+        std::vector<V> bp; // -1 for src & unreachable vertices
+        std::vector<entry> min_heap;
+        std::vector<unsigned> mark; // epoch stamp of invalidated vertices
+        unsigned epoch = 0;
+        std::size_t affected = 0, settled = 0; // of last batch
+
+        static std::size_t find(const std::vector<std::pair<V, W>>& list, V v) {
+            for (std::size_t i = 0; i < list.size(); i++)
+                if (list[i].first == v) return i;
+            return list.size();
+        }
+
+        // sets weight of u -> v (or removes it when w == INF) in both lists, returns old weight (INF if absent)
+        W assign(V u, V v, W w) {
+            std::size_t i = find(out[u], v), j = find(in[v], u);
+            W old = i < out[u].size() ? out[u][i].second : INF;
+            if (w == INF) {
+                if (i == out[u].size()) return old;
+                out[u][i] = out[u].back(); out[u].pop_back();
+                in[v][j] = in[v].back(); in[v].pop_back();
+            } else if (i < out[u].size()) {
+                out[u][i].second = in[v][j].second = w;
+            } else {
+                out[u].push_back({v, w});
+                in[v].push_back({u, w});
+            }
+            return old;
+        }
+
+        void push(V v, W d) {
+            min_heap.push_back({d, v});
+            std::push_heap(min_heap.begin(), min_heap.end(), std::greater<entry>());
+        }
+
+        void lower(V v, W d, V prev) {
+            if (d >= dist[v]) return;
+            dist[v] = d;
+            bp[v] = prev;
+            push(v, d);
+        }
+
+        // dijkstra's from every queued vertex
+        void propagate() {
+            while (!min_heap.empty()) {
+                std::pop_heap(min_heap.begin(), min_heap.end(), std::greater<entry>());
+                auto [d, curr] = min_heap.back(); min_heap.pop_back();
+                if (d != dist[curr]) continue;
+                settled++;
+                for (auto [next, weight] : out[curr]) lower(next, d + weight, curr);
+            }
+        }
+
+    public:
+        // builds adjacency from an edge set & runs one full dijkstra's from p_src
+        DynamicSSSP(const std::vector<edge>& edges, int p_n, int p_src) : n(p_n), src(p_src), out(p_n), in(p_n), dist(p_n, INF), bp(p_n, -1), mark(p_n, 0) {
+            for (const auto& e : edges) {
+                if (e.weight < 0) throw std::invalid_argument("dynamic sssp requires non-negative edge weights");
+                if ((W) e.weight < edgeWeight(e.from, e.to)) assign(e.from, e.to, (W) e.weight);
+            }
+            dist[src] = 0;
+            push(src, 0);
+            propagate();
+        }
+
+        /* applies a batch of edge changes (weight >= INF deletes the edge, a missing edge is inserted)
+        //   - increases are applied first (one invalidation & re-settling of the union of affected subtrees), then
+        //     decreases are queued, then a single dijkstra's repairs both
+        */
+        void update(const std::vector<edge>& changes) {
+            affected = settled = 0;
+            if (++epoch == 0) {
+                std::fill(mark.begin(), mark.end(), 0);
+                epoch = 1;
+            }
+            std::vector<V> roots, stack, invalid;
+            std::vector<std::pair<V, V>> decreased;
+            for (const auto& e : changes) {
+                if (e.weight < 0) throw std::invalid_argument("dynamic sssp requires non-negative edge weights");
+                W w = e.weight >= (double) INF ? INF : (W) e.weight;
+                W old = assign(e.from, e.to, w);
+                if (w > old && bp[e.to] == e.from) roots.push_back(e.to);
+                else if (w < old) decreased.push_back({e.from, e.to});
+            }
+            // invalidates subtrees: children of x are out-neighbors y with bp[y] == x
+            for (V root : roots) {
+                if (mark[root] == epoch) continue;
+                mark[root] = epoch;
+                stack.push_back(root);
+                while (!stack.empty()) {
+                    V x = stack.back(); stack.pop_back();
+                    invalid.push_back(x);
+                    for (auto [y, weight] : out[x]) {
+                        if (bp[y] != x || mark[y] == epoch) continue;
+                        mark[y] = epoch;
+                        stack.push_back(y);
+                    }
+                }
+            }
+            // invalidated vertices lose distance & parent, then get tentative distances from valid in-neighbors
+            for (V x : invalid) {
+                dist[x] = INF;
+                bp[x] = -1;
+            }
+            affected = invalid.size();
+            for (V x : invalid) {
+                for (auto [prev, weight] : in[x])
+                    if (mark[prev] != epoch && dist[prev] != INF) lower(x, dist[prev] + weight, prev);
+            }
+            // invalidated tails are relaxed when they settle, so only valid tails are queued here
+            for (auto [u, v] : decreased) {
+                if (mark[u] == epoch || dist[u] == INF) continue;
+                std::size_t i = find(out[u], v);
+                if (i < out[u].size()) lower(v, dist[u] + out[u][i].second, u);
+            }
+            propagate();
+        }
+
+        void setEdge(int u, int v, W w) { update({edge(u, v, (double) w)}); }
+        void removeEdge(int u, int v) { update({edge(u, v, (double) INF)}); }
+
+        std::size_t size() const { return n; }
+        int source() const { return src; }
+        // vertices invalidated & vertices settled by last update
+        std::size_t affectedCount() const { return affected; }
+        std::size_t settledCount() const { return settled; }
+
+        // weight of edge u -> v (INF if there is none)
+        W edgeWeight(int u, int v) const {
+            std::size_t i = find(out[u], v);
+            return i < out[u].size() ? out[u][i].second : INF;
+        }
+
+        // current out-edges of u as {target, weight}
+        const std::vector<std::pair<V, W>>& neighbors(int u) const { return out[u]; }
+
+        W distance(int v) const { return dist[v]; }
+        int parent(int v) const { return bp[v]; }
+
+        // vertices along shortest path from source to dest (empty if unreachable)
+        std::vector<int> path(int dest) const {
+            std::vector<int> path;
+            if (dist[dest] == INF) return path;
+            for (int v = dest; v != -1; v = bp[v]) path.push_back(v);
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+};
@@ -1,13 +1,8 @@
 #include <vector>
+#include <climits>
 #include <iostream>
 #include <iomanip>
-
-struct edge {
-    double weight;
-    int from, to;
-    edge(int p_from, int p_to, double p_weight) : from(p_from), to(p_to), weight(p_weight) {}
-    edge(int p_from, int p_to) : from(p_from), to(p_to), weight(0) {}
-};
+#include "Graph.h"
 
 void preprocessGraph(const std::vector<edge>& edges, int n);
 void floydWarshall(int n);
@@ -55,13 +50,13 @@ void floydWarshall(int n) {
 
 // returns vertices traversed along shortest path from vertex i to j
 // note: if negative cycles are present, must run checkNegCycles before calling path reconstruction to prevent false paths
+// note: forward pointers already give the path in order, so it is counted first & filled into one allocation
 std::vector<int> constructShortestPath(int src, int dest) {
-    std::vector<int> path = {src};
-    int next = fp_matrix[src][dest];
-    while (next != -1) {
-        path.push_back(next);
-        next = fp_matrix[next][dest];
-    }
+    int length = 1;
+    for (int next = fp_matrix[src][dest]; next != -1; next = fp_matrix[next][dest]) length++;
+    std::vector<int> path(length);
+    path[0] = src;
+    for (int i = 1, next = fp_matrix[src][dest]; next != -1; next = fp_matrix[next][dest]) path[i++] = next;
     return path;
 }
 
@@ -0,0 +1,141 @@
+#pragma once
+#include <cmath>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include "Graph.h"
+
+/* seeded workload generators - every generator returns a directed edge set on vertices [0, n)
+//   - weights are drawn uniformly from [min_weight, max_weight] (rounded to integers)
+//   - negative weights without negative cycles: reweight a non-negative edge set by random vertex potentials
+//   - negative cycles on demand: plant one with plantNegativeCycle
+*/
+
+// draws integer-valued edge weights
+class WeightSampler {
+    private:
+        std::uniform_int_distribution<long long> dist;
+    public:
+        WeightSampler(double min_weight, double max_weight) : dist((long long) min_weight, (long long) max_weight) {}
+        template <typename R>
+        double operator()(R& rng) { return (double) dist(rng); }
+};
+
+// side x side grid, every vertex connected to its 4 neighbors in both directions
+inline std::vector<edge> gridGraph(int side, unsigned seed, double min_weight = 1, double max_weight = 100) {
+    std::mt19937_64 rng(seed);
+    WeightSampler w(min_weight, max_weight);
+    std::vector<edge> edges;
+    edges.reserve(4ull * side * side);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) { edges.push_back({u, u + 1, w(rng)}); edges.push_back({u + 1, u, w(rng)}); }
+            if (r + 1 < side) { edges.push_back({u, u + side, w(rng)}); edges.push_back({u + side, u, w(rng)}); }
+        }
+    }
+    return edges;
+}
+
+// road-like random geometric graph: n points in unit square, each linked both ways to its k nearest points,
+// weight = euclidean distance scaled to [1, scale] (weights satisfy the triangle inequality like road lengths)
+inline std::vector<edge> geometricGraph(int n, int k, unsigned seed, double scale = 10000) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> coord(0, 1);
+    std::vector<double> x(n), y(n);
+    for (int i = 0; i < n; i++) { x[i] = coord(rng); y[i] = coord(rng); }
+    // buckets points into a cells x cells grid so neighbor search only scans nearby cells
+    int cells = std::max(1, (int) std::sqrt(n / 2.0));
+    std::vector<std::vector<int>> grid(cells * cells);
+    auto cellOf = [&](double v) { return std::min(cells - 1, (int) (v * cells)); };
+    for (int i = 0; i < n; i++) grid[cellOf(y[i]) * cells + cellOf(x[i])].push_back(i);
+    std::vector<edge> edges;
+    edges.reserve(2ull * n * k);
+    std::vector<std::pair<double, int>> candidates;
+    for (int i = 0; i < n; i++) {
+        int cx = cellOf(x[i]), cy = cellOf(y[i]);
+        for (int radius = 1; ; radius++) {
+            candidates.clear();
+            for (int gy = std::max(0, cy - radius); gy <= std::min(cells - 1, cy + radius); gy++)
+                for (int gx = std::max(0, cx - radius); gx <= std::min(cells - 1, cx + radius); gx++)
+                    for (int j : grid[gy * cells + gx])
+                        if (j != i) candidates.push_back({std::hypot(x[i] - x[j], y[i] - y[j]), j});
+            if ((int) candidates.size() >= k || radius >= cells) break;
+        }
+        int take = std::min<int>(k, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + take, candidates.end());
+        for (int c = 0; c < take; c++) {
+            double w = std::max(1.0, std::round(candidates[c].first * scale));
+            edges.push_back({i, candidates[c].second, w});
+            edges.push_back({candidates[c].second, i, w});
+        }
+    }
+    return edges;
+}
+
+// erdos-renyi G(n, m): m directed edges with endpoints drawn uniformly at random (self loops skipped)
+inline std::vector<edge> erdosRenyiGraph(int n, std::size_t m, unsigned seed, double min_weight = 1, double max_weight = 100) {
+    std::mt19937_64 rng(seed);
+    WeightSampler w(min_weight, max_weight);
+    std::vector<edge> edges;
+    edges.reserve(m);
+    while (edges.size() < m) {
+        int u = rng() % n, v = rng() % n;
+        if (u != v) edges.push_back({u, v, w(rng)});
+    }
+    return edges;
+}
+
+// r-mat / kronecker power-law graph on 2^scale vertices: each edge picks a quadrant of the adjacency matrix
+// with probabilities (a, b, c, 1 - a - b - c) at every level, producing skewed degree distributions
+// note: vertex ids are randomly permuted so high degree vertices aren't clustered at low ids
+inline std::vector<edge> rmatGraph(int scale, std::size_t m, unsigned seed, double min_weight = 1, double max_weight = 100,
+                                   double a = 0.57, double b = 0.19, double c = 0.19) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> coin(0, 1);
+    WeightSampler w(min_weight, max_weight);
+    int n = 1 << scale;
+    std::vector<int> perm(n);
+    for (int i = 0; i < n; i++) perm[i] = i;
+    std::shuffle(perm.begin(), perm.end(), rng);
+    std::vector<edge> edges;
+    edges.reserve(m);
+    while (edges.size() < m) {
+        int u = 0, v = 0;
+        for (int level = 0; level < scale; level++) {
+            double r = coin(rng);
+            int bit_u = r >= a + b, bit_v = (r >= a && r < a + b) || r >= a + b + c;
+            u = (u << 1) | bit_u;
+            v = (v << 1) | bit_v;
+        }
+        if (u != v) edges.push_back({perm[u], perm[v], w(rng)});
+    }
+    return edges;
+}
+
+// random integer vertex potentials in [0, max_potential]
+inline std::vector<double> randomPotentials(int n, unsigned seed, double max_potential = 100) {
+    std::mt19937_64 rng(seed);
+    WeightSampler p(0, max_potential);
+    std::vector<double> potential(n);
+    for (auto& x : potential) x = p(rng);
+    return potential;
+}
+
+// w'(u, v) = w(u, v) + p(u) - p(v): every cycle keeps its weight & shortest path trees don't change, but
+// d'(s, t) = d(s, t) + p(s) - p(t) - so non-negative input gives negative edges without negative cycles
+inline std::vector<edge> reweightByPotential(std::vector<edge> edges, const std::vector<double>& potential) {
+    for (auto& e : edges) e.weight += potential[e.from] - potential[e.to];
+    return edges;
+}
+
+// adds a directed cycle through `length` distinct random vertices with total weight -1 (length >= 2)
+inline std::vector<edge> plantNegativeCycle(std::vector<edge> edges, int n, int length, unsigned seed, double weight = 1) {
+    std::mt19937_64 rng(seed);
+    std::vector<int> perm(n);
+    for (int i = 0; i < n; i++) perm[i] = i;
+    for (int i = 0; i < length; i++) std::swap(perm[i], perm[i + rng() % (n - i)]);
+    for (int i = 0; i + 1 < length; i++) edges.push_back({perm[i], perm[i + 1], weight});
+    edges.push_back({perm[length - 1], perm[0], -(length - 1) * weight - 1});
+    return edges;
+}
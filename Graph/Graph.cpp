@@ -0,0 +1,71 @@
+#include <queue>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <iomanip>
+#include <iostream>
+#include <unordered_map>
+#include "Graph.h"
+
+typedef std::unordered_map<int, std::vector<std::pair<int, double>>> hash_adj;
+typedef std::pair<double, int> pdi;
+
+template <typename F>
+double timeIt(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// lazy-insertion dijkstra's over any adjacency that maps a vertex to a range of {next, weight} pairs
+template <typename Neighbors>
+std::vector<double> dijkstras(int src, int n, Neighbors neighbors) {
+    std::vector<double> dist(n, INT_MAX);
+    std::priority_queue<pdi, std::vector<pdi>, std::greater<pdi>> min_heap;
+    dist[src] = 0;
+    min_heap.push({0, src});
+    while (!min_heap.empty()) {
+        auto [d, curr] = min_heap.top(); min_heap.pop();
+        if (d != dist[curr]) continue;
+        for (auto [next, weight] : neighbors(curr)) {
+            if (d + weight < dist[next]) {
+                dist[next] = d + weight;
+                min_heap.push({dist[next], next});
+            }
+        }
+    }
+    return dist;
+}
+
+// sample test case & benchmark comparing csr graph against hash map adjacency list
+int main() {
+    std::vector<edge> edges = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, 5}, {0, 4, 5}};
+    CSRGraph<> graph(edges, 5);
+    CSRGraph<> reverse = graph.transpose();
+    std::cout << "In-edges of vertex 3:";
+    for (auto [prev, weight] : reverse.neighbors(3))
+        std::cout << " (" << prev << ", " << weight << ")";
+    std::cout << '\n';
+
+    std::cout << '\n' << std::left << std::setw(12) << "n" << std::setw(12) << "m" << std::setw(18) << "hash build (ms)" << std::setw(18) << "csr build (ms)"
+              << std::setw(20) << "hash dijkstra (ms)" << std::setw(20) << "csr dijkstra (ms)" << '\n';
+    std::mt19937 rng(42);
+    for (int n : {100000, 1000000}) {
+        std::size_t m = 8ull * n;
+        std::vector<edge> random_edges;
+        random_edges.reserve(m);
+        for (std::size_t i = 0; i < m; i++)
+            random_edges.push_back({(int) (rng() % n), (int) (rng() % n), (double) (rng() % 100 + 1)});
+        hash_adj adj_list;
+        CSRGraph<> csr;
+        double b1 = timeIt([&] { for (const auto& e : random_edges) adj_list[e.from].push_back({e.to, e.weight}); });
+        double b2 = timeIt([&] { csr = CSRGraph<>(random_edges, n); });
+        std::vector<double> d1, d2;
+        double t1 = timeIt([&] { d1 = dijkstras(0, n, [&](int v) -> const std::vector<std::pair<int, double>>& { return adj_list[v]; }); });
+        double t2 = timeIt([&] { d2 = dijkstras(0, n, [&](int v) { return csr.neighbors(v); }); });
+        if (d1 != d2) std::cout << "distance mismatch!\n";
+        std::cout << std::setw(12) << n << std::setw(12) << m << std::setw(18) << b1 << std::setw(18) << b2 << std::setw(20) << t1 << std::setw(20) << t2 << '\n';
+    }
+    return 0;
+}
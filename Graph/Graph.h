@@ -0,0 +1,139 @@
+#pragma once
+#include <atomic>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include "Parallel.h"
+
+// directed weighted edge shared by all graph algorithms
+struct edge {
+    double weight;
+    int from, to;
+    edge(int p_from, int p_to, double p_weight) : weight(p_weight), from(p_from), to(p_to) {}
+    edge(int p_from, int p_to) : weight(0), from(p_from), to(p_to) {}
+};
+
+/* compressed sparse row graph - adjacency stored in three contiguous arrays:
+//   - offsets[v] .. offsets[v + 1] indexes the out-edges of vertex v
+//   - targets[i], weights[i] hold head vertex & weight of out-edge i
+//   - neighbors of each vertex are sorted by target id (weight breaks ties)
+// @template
+//   - V: vertex id type, W: edge weight type
+*/
+template <typename V = int, typename W = double>
+class CSRGraph {
+    public:
+        typedef V vertex_type;
+        typedef W weight_type;
+
+        // range over out-edges of a vertex, iterates as {target, weight} pairs
+        class NeighborRange {
+            private:
+                const V* m_targets;
+                const W* m_weights;
+                std::size_t m_size;
+
+            public:
+                class iterator {
+                    private:
+                        const V* t;
+                        const W* w;
+                    public:
+                        iterator(const V* p_t, const W* p_w) : t(p_t), w(p_w) {}
+                        std::pair<V, W> operator*() const { return {*t, *w}; }
+                        iterator& operator++() { ++t; ++w; return *this; }
+                        bool operator!=(const iterator& other) const { return t != other.t; }
+                        bool operator==(const iterator& other) const { return t == other.t; }
+                };
+
+                NeighborRange(const V* p_targets, const W* p_weights, std::size_t p_size) : m_targets(p_targets), m_weights(p_weights), m_size(p_size) {}
+                iterator begin() const { return iterator(m_targets, m_weights); }
+                iterator end() const { return iterator(m_targets + m_size, m_weights + m_size); }
+                std::size_t size() const { return m_size; }
+                const V* targets() const { return m_targets; }
+                const W* weights() const { return m_weights; }
+        };
+
+    private:
+        std::size_t n;
+        std::vector<std::size_t> offsets;
+        std::vector<V> targets;
+        std::vector<W> weights;
+
+        // counting sort of edges by source vertex: parallel degree count, prefix sum, parallel scatter, per-vertex sort
+        template <typename E>
+        void build(const std::vector<E>& edges, unsigned threads) {
+            std::size_t m = edges.size();
+            for (const auto& e : edges)
+                if ((std::size_t) e.from >= n || (std::size_t) e.to >= n) throw std::out_of_range("edge endpoint is not a vertex of graph");
+            std::vector<std::atomic<std::size_t>> cursor(n + 1);
+            for (auto& c : cursor) c.store(0, std::memory_order_relaxed);
+            parallelFor(0, m, [&](unsigned, std::size_t lo, std::size_t hi) {
+                for (std::size_t i = lo; i < hi; i++)
+                    cursor[edges[i].from + 1].fetch_add(1, std::memory_order_relaxed);
+            }, threads);
+            offsets.assign(n + 1, 0);
+            for (std::size_t v = 0; v < n; v++) {
+                offsets[v + 1] = offsets[v] + cursor[v + 1].load(std::memory_order_relaxed);
+                cursor[v].store(offsets[v], std::memory_order_relaxed);
+            }
+            targets.resize(m);
+            weights.resize(m);
+            parallelFor(0, m, [&](unsigned, std::size_t lo, std::size_t hi) {
+                for (std::size_t i = lo; i < hi; i++) {
+                    std::size_t pos = cursor[edges[i].from].fetch_add(1, std::memory_order_relaxed);
+                    targets[pos] = (V) edges[i].to;
+                    weights[pos] = (W) edges[i].weight;
+                }
+            }, threads);
+            // scatter order depends on thread timing, sorting each neighbor list makes layout deterministic
+            parallelFor(0, n, [&](unsigned, std::size_t lo, std::size_t hi) {
+                std::vector<std::pair<V, W>> scratch;
+                for (std::size_t v = lo; v < hi; v++) {
+                    std::size_t b = offsets[v], e = offsets[v + 1];
+                    scratch.clear();
+                    for (std::size_t i = b; i < e; i++) scratch.push_back({targets[i], weights[i]});
+                    std::sort(scratch.begin(), scratch.end());
+                    for (std::size_t i = b; i < e; i++) std::tie(targets[i], weights[i]) = scratch[i - b];
+                }
+            }, threads, 1 << 12);
+        }
+
+    public:
+        CSRGraph() : n(0), offsets(1, 0) {}
+
+        // builds graph on vertices [0, n) from an edge set with from, to & weight fields
+        template <typename E>
+        CSRGraph(const std::vector<E>& edges, std::size_t p_n, unsigned threads = defaultThreads()) : n(p_n) {
+            build(edges, threads);
+        }
+
+        // builds graph directly from csr arrays
+        CSRGraph(std::vector<std::size_t> p_offsets, std::vector<V> p_targets, std::vector<W> p_weights)
+            : n(p_offsets.size() - 1), offsets(std::move(p_offsets)), targets(std::move(p_targets)), weights(std::move(p_weights)) {}
+
+        std::size_t vertexCount() const { return n; }
+        std::size_t edgeCount() const { return targets.size(); }
+        std::size_t degree(V v) const { return offsets[v + 1] - offsets[v]; }
+
+        // out-edges of vertex v
+        NeighborRange neighbors(V v) const {
+            return NeighborRange(targets.data() + offsets[v], weights.data() + offsets[v], offsets[v + 1] - offsets[v]);
+        }
+
+        const std::vector<std::size_t>& offsetArray() const { return offsets; }
+        const std::vector<V>& targetArray() const { return targets; }
+        const std::vector<W>& weightArray() const { return weights; }
+
+        // builds reverse graph (every edge u -> v becomes v -> u)
+        CSRGraph transpose(unsigned threads = defaultThreads()) const {
+            struct rev { V from, to; W weight; };
+            std::vector<rev> edges;
+            edges.reserve(targets.size());
+            for (std::size_t u = 0; u < n; u++)
+                for (std::size_t i = offsets[u]; i < offsets[u + 1]; i++)
+                    edges.push_back({targets[i], (V) u, weights[i]});
+            return CSRGraph(edges, n, threads);
+        }
+};
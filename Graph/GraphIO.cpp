@@ -0,0 +1,125 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <iostream>
+#include <filesystem>
+#include "GraphIO.h"
+#include "Generators.h"
+#include "DijkstraEngine.h"
+
+typedef CSRGraph<int, double> graph_t;
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void writeText(const std::string& path, const std::string& text) {
+    std::ofstream(path) << text;
+}
+
+// writes edges as dimacs .gr (1-based ids) or as a plain edge list
+void writeEdges(const std::string& path, const std::vector<edge>& edges, int n, bool dimacs) {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) throw std::runtime_error("failed to open " + path);
+    if (dimacs) std::fprintf(file, "c generated graph\np sp %d %zu\n", n, edges.size());
+    else std::fprintf(file, "# generated graph\n");
+    for (const auto& e : edges) {
+        if (dimacs) std::fprintf(file, "a %d %d %d\n", e.from + 1, e.to + 1, (int) e.weight);
+        else std::fprintf(file, "%d %d %d\n", e.from, e.to, (int) e.weight);
+    }
+    bool ok = !std::ferror(file);
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) throw std::runtime_error("failed to write " + path);
+}
+
+// baseline: iostream extraction into an edge vector
+graph_t parseWithStreams(const std::string& path) {
+    std::ifstream in(path);
+    std::vector<edge> edges;
+    std::string line;
+    int n = 0;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream fields(line);
+        int u, v;
+        double w;
+        fields >> u >> v >> w;
+        edges.push_back({u, v, w});
+        n = std::max({n, u + 1, v + 1});
+    }
+    return graph_t(edges, n);
+}
+
+// sample test cases & load time benchmark for graph file formats
+int main() {
+    std::string dir = std::filesystem::temp_directory_path().string() + "/";
+    writeText(dir + "sample.gr", "c sample graph\np sp 5 6\na 1 2 2\na 2 3 1\na 2 4 4\na 4 5 1\na 3 4 5\na 1 5 5\n");
+    writeText(dir + "sample.txt", "# sample graph\n0 1 2\n1 2 1\n1 3 4\n3 4 1\n2 3 5\n0 4 5\n");
+    graph_t dimacs = parseDimacs(dir + "sample.gr"), list = parseEdgeList(dir + "sample.txt");
+    writeBinaryGraph(dimacs, dir + "sample.csr");
+    MappedGraph<int, double> mapped(dir + "sample.csr", true);
+    DijkstraEngine<MappedGraph<int, double>> engine(mapped);
+    engine.run(0);
+    std::cout << "dimacs: " << dimacs.vertexCount() << " vertices, " << dimacs.edgeCount() << " edges; edge list: "
+              << list.vertexCount() << " vertices, " << list.edgeCount() << " edges\n";
+    std::cout << std::left << std::setw(10) << "Vertex" << std::setw(10) << "Dist. from 0 (mapped)" << '\n';
+    for (int v = 1; v < 5; v++) std::cout << std::setw(10) << v << engine.distance(v) << '\n';
+    try {
+        MappedGraph<int, float> wrong(dir + "sample.csr");
+    } catch (const std::runtime_error& e) {
+        std::cout << "Rejected: " << e.what() << '\n';
+    }
+    for (const char* f : {"sample.gr", "sample.txt", "sample.csr"}) std::filesystem::remove(dir + f);
+
+    // load time of a 1M vertex, 8M edge graph from text & binary formats
+    const int n = 1 << 20;
+    std::vector<edge> edges = erdosRenyiGraph(n, 8ull * n, 42, 1, 1000);
+    writeEdges(dir + "bench.gr", edges, n, true);
+    writeEdges(dir + "bench.txt", edges, n, false);
+    std::cout << "\nn = " << n << ", m = " << edges.size() << " (text: " << std::filesystem::file_size(dir + "bench.txt") / (1 << 20) << " MB)\n"
+              << std::setw(36) << "loader" << std::setw(14) << "time (ms)" << "edges / s" << '\n';
+    auto report = [&](const std::string& name, double ms) {
+        std::cout << std::setw(36) << name << std::setw(14) << ms << edges.size() / ms * 1000 << '\n';
+    };
+    auto start = std::chrono::steady_clock::now();
+    graph_t baseline = parseWithStreams(dir + "bench.txt");
+    report("edge list, iostream", elapsed(start));
+    for (unsigned threads : {1, 4}) {
+        start = std::chrono::steady_clock::now();
+        graph_t g = parseEdgeList(dir + "bench.txt", threads);
+        report("edge list, parser (" + std::to_string(threads) + " threads)", elapsed(start));
+        if (g.targetArray() != baseline.targetArray() || g.weightArray() != baseline.weightArray()) std::cout << "edge list mismatch!\n";
+    }
+    start = std::chrono::steady_clock::now();
+    graph_t gr = parseDimacs(dir + "bench.gr");
+    report("dimacs, parser", elapsed(start));
+    if (gr.targetArray() != baseline.targetArray()) std::cout << "dimacs mismatch!\n";
+    start = std::chrono::steady_clock::now();
+    writeBinaryGraph(gr, dir + "bench.csr");
+    report("binary, write", elapsed(start));
+    start = std::chrono::steady_clock::now();
+    {
+        MappedGraph<int, double> m(dir + "bench.csr");
+        report("binary, map", elapsed(start));
+    }
+    start = std::chrono::steady_clock::now();
+    MappedGraph<int, double> big(dir + "bench.csr", true);
+    report("binary, map + verify checksum", elapsed(start));
+
+    // same query on mapped & in-memory graph
+    DijkstraEngine<MappedGraph<int, double>> on_disk(big);
+    DijkstraEngine<graph_t> in_memory(gr);
+    start = std::chrono::steady_clock::now();
+    on_disk.run(0);
+    double disk_ms = elapsed(start);
+    start = std::chrono::steady_clock::now();
+    in_memory.run(0);
+    double memory_ms = elapsed(start);
+    bool match = true;
+    for (int v = 0; v < n; v++) if (on_disk.distance(v) != in_memory.distance(v)) match = false;
+    std::cout << "\ndijkstra's on mapped graph: " << disk_ms << " ms, in memory: " << memory_ms << " ms, matches: " << (match ? "yes" : "no") << '\n';
+    for (const char* f : {"bench.gr", "bench.txt", "bench.csr"}) std::filesystem::remove(dir + f);
+    return 0;
+}
@@ -0,0 +1,317 @@
+#pragma once
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <stdexcept>
+#include <type_traits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "Graph.h"
+
+static_assert(sizeof(std::size_t) == sizeof(std::uint64_t), "binary graph format stores offsets as 64-bit integers");
+
+// read-only memory mapping of a whole file, unmapped on destruction
+class MappedFile {
+    private:
+        const char* m_data = nullptr;
+        std::size_t m_size = 0;
+
+    public:
+        explicit MappedFile(const std::string& path) {
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) throw std::runtime_error("failed to open " + path);
+            struct stat st;
+            if (::fstat(fd, &st) != 0) {
+                ::close(fd);
+                throw std::runtime_error("failed to stat " + path);
+            }
+            m_size = st.st_size;
+            if (m_size > 0) {
+                void* p = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p == MAP_FAILED) {
+                    ::close(fd);
+                    throw std::runtime_error("failed to map " + path);
+                }
+                m_data = (const char*) p;
+            }
+            ::close(fd);
+        }
+
+        ~MappedFile() {
+            if (m_data) ::munmap((void*) m_data, m_size);
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const char* data() const { return m_data; }
+        std::size_t size() const { return m_size; }
+
+        // hints that whole file will be read sequentially soon
+        void prefetch() const {
+            if (m_data) ::madvise((void*) m_data, m_size, MADV_WILLNEED);
+        }
+};
+
+/* binary csr file layout (little endian, every section starts on an 8 byte boundary):
+//   - header: magic "CSR1", vertex & weight byte widths, weight kind, n, m, checksum of the three sections
+//   - offsets: n + 1 x uint64, targets: m x V, weights: m x W
+//   - sections are padded with zeros to 8 bytes, so the file can be mapped & used without copying
+*/
+struct GraphFileHeader {
+    char magic[4];
+    std::uint16_t vertex_bytes;
+    std::uint16_t weight_bytes;
+    std::uint32_t weight_kind; // 0 = signed integer, 1 = floating point
+    std::uint32_t reserved;
+    std::uint64_t n, m;
+    std::uint64_t checksum;
+};
+
+inline std::size_t alignSection(std::size_t bytes) { return (bytes + 7) / 8 * 8; }
+
+// 64-bit hash of a byte range: word-wise fnv-1a over 1 MB chunks in parallel, then over the chunk hashes
+inline std::uint64_t graphChecksum(const char* data, std::size_t bytes, unsigned threads = defaultThreads()) {
+    const std::size_t chunk = 1 << 20, prime = 1099511628211ull, basis = 14695981039346656037ull;
+    std::size_t chunks = (bytes + chunk - 1) / chunk;
+    std::vector<std::uint64_t> hashes(chunks);
+    parallelFor(0, chunks, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t c = lo; c < hi; c++) {
+            const char* p = data + c * chunk;
+            std::size_t len = std::min(chunk, bytes - c * chunk);
+            std::uint64_t h = basis, word;
+            std::size_t i = 0;
+            for (; i + 8 <= len; i += 8) {
+                std::memcpy(&word, p + i, 8);
+                h = (h ^ word) * prime;
+            }
+            for (; i < len; i++) h = (h ^ (unsigned char) p[i]) * prime;
+            hashes[c] = h;
+        }
+    }, threads, 4);
+    std::uint64_t h = basis ^ bytes;
+    for (std::uint64_t x : hashes) h = (h ^ x) * prime;
+    return h;
+}
+
+// checksum stored in graph files: combines hashes of offset, target & weight sections (padding excluded)
+inline std::uint64_t graphChecksum(const char* offsets, std::size_t offset_bytes, const char* targets, std::size_t target_bytes,
+                                   const char* weights, std::size_t weight_bytes, unsigned threads = defaultThreads()) {
+    const std::uint64_t prime = 1099511628211ull;
+    std::uint64_t h = graphChecksum(offsets, offset_bytes, threads);
+    h = (h ^ graphChecksum(targets, target_bytes, threads)) * prime;
+    return (h ^ graphChecksum(weights, weight_bytes, threads)) * prime;
+}
+
+// writes graph in binary csr format readable by MappedGraph
+template <typename V, typename W>
+void writeBinaryGraph(const CSRGraph<V, W>& graph, const std::string& path, unsigned threads = defaultThreads()) {
+    static_assert(std::is_integral<V>::value && std::is_arithmetic<W>::value, "binary graph format stores integer ids & numeric weights");
+    const auto& offsets = graph.offsetArray();
+    const auto& targets = graph.targetArray();
+    const auto& weights = graph.weightArray();
+    std::size_t n = graph.vertexCount(), m = graph.edgeCount();
+    std::size_t offset_bytes = (n + 1) * sizeof(std::uint64_t), target_bytes = m * sizeof(V), weight_bytes = m * sizeof(W);
+    GraphFileHeader header = {{'C', 'S', 'R', '1'}, sizeof(V), sizeof(W), std::is_floating_point<W>::value, 0, n, m,
+                              graphChecksum((const char*) offsets.data(), offset_bytes, (const char*) targets.data(), target_bytes,
+                                            (const char*) weights.data(), weight_bytes, threads)};
+    const char zeros[8] = {};
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) throw std::runtime_error("failed to open " + path);
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 && std::fwrite(offsets.data(), 1, offset_bytes, file) == offset_bytes
+        && std::fwrite(targets.data(), 1, target_bytes, file) == target_bytes
+        && std::fwrite(zeros, 1, alignSection(target_bytes) - target_bytes, file) == alignSection(target_bytes) - target_bytes
+        && std::fwrite(weights.data(), 1, weight_bytes, file) == weight_bytes
+        && std::fwrite(zeros, 1, alignSection(weight_bytes) - weight_bytes, file) == alignSection(weight_bytes) - weight_bytes;
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) throw std::runtime_error("failed to write " + path);
+}
+
+/* zero-copy graph over a memory-mapped binary csr file
+//   - same read interface as CSRGraph (vertexCount, edgeCount, degree, neighbors), so templated algorithms such as
+//     DijkstraEngine or BellmanFordEngine run on it directly; pages are loaded by the os on first access
+//   - header is validated against V & W, the checksum is only verified on request since it touches every page
+*/
+template <typename V = int, typename W = double>
+class MappedGraph {
+    public:
+        typedef V vertex_type;
+        typedef W weight_type;
+        typedef typename CSRGraph<V, W>::NeighborRange NeighborRange;
+
+    private:
+        MappedFile file;
+        std::size_t n, m;
+        const std::size_t* offsets;
+        const V* targets;
+        const W* weights;
+
+    public:
+        explicit MappedGraph(const std::string& path, bool verify = false, unsigned threads = defaultThreads()) : file(path) {
+            GraphFileHeader header;
+            if (file.size() < sizeof(header)) throw std::runtime_error("malformed graph file " + path);
+            std::memcpy(&header, file.data(), sizeof(header));
+            if (std::memcmp(header.magic, "CSR1", 4) != 0 || header.vertex_bytes != sizeof(V) || header.weight_bytes != sizeof(W)
+                || header.weight_kind != std::is_floating_point<W>::value)
+                throw std::runtime_error("graph file " + path + " does not match requested vertex / weight types");
+            n = header.n;
+            m = header.m;
+            std::size_t offset_bytes = (n + 1) * sizeof(std::uint64_t), body = offset_bytes + alignSection(m * sizeof(V)) + alignSection(m * sizeof(W));
+            if (file.size() != sizeof(header) + body) throw std::runtime_error("truncated graph file " + path);
+            const char* base = file.data() + sizeof(header);
+            offsets = (const std::size_t*) base;
+            targets = (const V*) (base + offset_bytes);
+            weights = (const W*) (base + offset_bytes + alignSection(m * sizeof(V)));
+            if (verify && graphChecksum(base, offset_bytes, (const char*) targets, m * sizeof(V), (const char*) weights, m * sizeof(W), threads) != header.checksum)
+                throw std::runtime_error("checksum mismatch in " + path);
+        }
+
+        std::size_t vertexCount() const { return n; }
+        std::size_t edgeCount() const { return m; }
+        std::size_t degree(V v) const { return offsets[v + 1] - offsets[v]; }
+
+        NeighborRange neighbors(V v) const {
+            return NeighborRange(targets + offsets[v], weights + offsets[v], offsets[v + 1] - offsets[v]);
+        }
+
+        const std::size_t* offsetData() const { return offsets; }
+        const V* targetData() const { return targets; }
+        const W* weightData() const { return weights; }
+
+        // copies mapped arrays into an owning graph (for algorithms that need offsetArray() etc.)
+        CSRGraph<V, W> toCSRGraph() const {
+            return CSRGraph<V, W>(std::vector<std::size_t>(offsets, offsets + n + 1), std::vector<V>(targets, targets + m), std::vector<W>(weights, weights + m));
+        }
+};
+
+namespace detail {
+    template <typename V, typename W>
+    struct ParsedEdge { V from, to; W weight; };
+
+    inline const char* skipBlanks(const char* p, const char* end) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+        return p;
+    }
+
+    inline const char* skipLine(const char* p, const char* end) {
+        const char* nl = (const char*) std::memchr(p, '\n', end - p);
+        return nl ? nl + 1 : end;
+    }
+
+    // parses next number on the current line into x, returns nullptr if there is none or it is malformed
+    template <typename T>
+    const char* parseField(const char* p, const char* end, T& x) {
+        p = skipBlanks(p, end);
+        if (p == end || *p == '\n') return nullptr;
+        if (*p == '+') p++;
+        auto [ptr, ec] = std::from_chars(p, end, x);
+        return ec == std::errc() ? ptr : nullptr;
+    }
+
+    /* splits text into one chunk per thread at line boundaries, parses every line with parseLine(p, end, edges)
+    //   - parseLine gets a pointer to the first non-blank character of a line & returns false on malformed input
+    //   - a line belongs to the chunk its first character is in, but may be read past the chunk end
+    */
+    template <typename V, typename W, typename F>
+    std::vector<ParsedEdge<V, W>> parseChunks(const MappedFile& file, const std::string& path, unsigned threads, F&& parseLine) {
+        const char* begin = file.data();
+        const char* end = begin + file.size();
+        threads = std::max(1u, threads);
+        std::vector<const char*> starts(threads + 1, end);
+        starts[0] = begin;
+        for (unsigned t = 1; t < threads; t++) {
+            const char* p = begin + file.size() * t / threads;
+            starts[t] = p == begin ? p : skipLine(p - 1, end);
+            starts[t] = std::max(starts[t], starts[t - 1]);
+        }
+        std::vector<std::vector<ParsedEdge<V, W>>> local(threads);
+        std::vector<std::size_t> bad_line(threads, 0); // byte offset + 1 of first malformed line per chunk
+        parallelFor(0, threads, [&](unsigned, std::size_t lo, std::size_t hi) {
+            for (std::size_t t = lo; t < hi; t++) {
+                local[t].reserve((starts[t + 1] - starts[t]) / 16);
+                for (const char* p = starts[t]; p < starts[t + 1]; p = skipLine(p, end)) {
+                    const char* line = skipBlanks(p, end);
+                    if (line == end || *line == '\n') continue;
+                    if (!parseLine(line, end, local[t])) {
+                        bad_line[t] = line - begin + 1;
+                        break;
+                    }
+                }
+            }
+        }, threads, 1);
+        for (std::size_t b : bad_line)
+            if (b) throw std::runtime_error("malformed line at byte " + std::to_string(b - 1) + " in " + path);
+        std::size_t total = 0;
+        for (const auto& l : local) total += l.size();
+        std::vector<ParsedEdge<V, W>> edges;
+        edges.reserve(total);
+        for (auto& l : local) {
+            edges.insert(edges.end(), l.begin(), l.end());
+            std::vector<ParsedEdge<V, W>>().swap(l);
+        }
+        return edges;
+    }
+}
+
+/* parses a dimacs shortest path file (.gr) with multiple threads
+//   - "c ..." comment, "p sp <n> <m>" problem line, "a <u> <v> <w>" arc with 1-based vertex ids
+*/
+template <typename V = int, typename W = double>
+CSRGraph<V, W> parseDimacs(const std::string& path, unsigned threads = defaultThreads()) {
+    MappedFile file(path);
+    file.prefetch();
+    std::mutex mtx;
+    long long n = -1;
+    auto edges = detail::parseChunks<V, W>(file, path, threads, [&](const char* p, const char* end, auto& out) {
+        if (*p == 'c') return true;
+        if (*p == 'p') {
+            p = detail::skipBlanks(p + 1, end);
+            while (p < end && *p != ' ' && *p != '\t') p++; // problem type, e.g. "sp"
+            long long vertices, arcs;
+            if (!(p = detail::parseField(p, end, vertices)) || !detail::parseField(p, end, arcs)) return false;
+            std::lock_guard<std::mutex> lock(mtx);
+            n = vertices;
+            return true;
+        }
+        if (*p != 'a') return false;
+        V u, v;
+        W w;
+        if (!(p = detail::parseField(p + 1, end, u)) || !(p = detail::parseField(p, end, v)) || !detail::parseField(p, end, w)) return false;
+        out.push_back({(V) (u - 1), (V) (v - 1), w});
+        return true;
+    });
+    if (n < 0) throw std::runtime_error("missing problem line in " + path);
+    for (const auto& e : edges)
+        if (e.from < 0 || e.to < 0 || e.from >= n || e.to >= n) throw std::runtime_error("vertex id out of range in " + path);
+    return CSRGraph<V, W>(edges, n, threads);
+}
+
+/* parses a whitespace separated edge list with multiple threads
+//   - one "<u> <v> [w]" edge per line with 0-based vertex ids, missing weights default to 1
+//   - lines starting with '#' or '%' are comments, n = largest vertex id + 1
+*/
+template <typename V = int, typename W = double>
+CSRGraph<V, W> parseEdgeList(const std::string& path, unsigned threads = defaultThreads()) {
+    MappedFile file(path);
+    file.prefetch();
+    auto edges = detail::parseChunks<V, W>(file, path, threads, [](const char* p, const char* end, auto& out) {
+        if (*p == '#' || *p == '%') return true;
+        V u, v;
+        W w = 1;
+        if (!(p = detail::parseField(p, end, u)) || !(p = detail::parseField(p, end, v)) || u < 0 || v < 0) return false;
+        p = detail::skipBlanks(p, end);
+        if (p < end && *p != '\n' && !detail::parseField(p, end, w)) return false;
+        out.push_back({u, v, w});
+        return true;
+    });
+    // counted in size_t (0 = no edges) since a V sentinel of -1 would wrap for unsigned ids
+    std::size_t n = 0;
+    for (const auto& e : edges) n = std::max({n, (std::size_t) e.from + 1, (std::size_t) e.to + 1});
+    return CSRGraph<V, W>(edges, n, threads);
+}
@@ -0,0 +1,72 @@
+#include <mutex>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "Johnson.h"
+
+typedef CSRGraph<int, long long> graph_t;
+typedef Johnson<graph_t> johnson_t;
+
+// sample test cases & benchmark for johnson's algorithm
+int main() {
+    int n = 5;
+    std::vector<edge> edges = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, -3}, {0, 4, 9}};
+    graph_t graph(edges, n);
+    johnson_t johnson(graph);
+    std::vector<int> all = {0, 1, 2, 3, 4};
+    std::vector<std::vector<long long>> dist = johnson.matrix(all);
+    std::cout << "Sample shortest path matrix:\n" << std::left;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (dist[i][j] == johnson_t::INF) std::cout << std::setw(5) << "+Inf" << ' ';
+            else std::cout << std::setw(5) << dist[i][j] << ' ';
+        }
+        std::cout << '\n';
+    }
+    try {
+        johnson_t(graph_t(std::vector<edge>{{0, 1, 2}, {1, 2, 1}, {2, 2, -3}}, 3));
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Negative cycle: " << e.what() << '\n';
+    }
+
+    // verifies streamed rows against bellman ford from each source
+    const int small = 2000;
+    graph_t check(reweightByPotential(erdosRenyiGraph(small, 8 * small, 42), randomPotentials(small, 7, 60)), small);
+    BellmanFordEngine<graph_t> bf(check);
+    std::size_t mismatches = 0;
+    std::mutex mtx;
+    std::vector<int> sources;
+    for (int s = 0; s < small; s += 97) sources.push_back(s);
+    johnson_t(check).run(sources, [&](int src, const std::vector<long long>& row) {
+        std::vector<long long> expected = bf.run(src).dist;
+        std::lock_guard<std::mutex> lock(mtx);
+        for (int v = 0; v < small; v++) mismatches += row[v] != expected[v];
+    });
+    std::cout << "\nmismatches against bellman ford (" << sources.size() << " sources): " << mismatches << '\n';
+
+    // streams rows from a subset of sources on a large sparse graph, keeping only a per-row summary
+    const int big = 200000, count = 32;
+    graph_t large(reweightByPotential(erdosRenyiGraph(big, 8 * big, 42), randomPotentials(big, 7, 60)), big);
+    sources.clear();
+    for (int i = 0; i < count; i++) sources.push_back((long long) i * big / count);
+    std::cout << "\nn = " << big << ", m = " << large.edgeCount() << ", " << count << " sources, full table would need "
+              << (double) big * big * sizeof(long long) / (1 << 30) << " GiB\n" << std::left << std::setw(10) << "threads"
+              << std::setw(18) << "potentials (ms)" << std::setw(16) << "rows (ms)" << std::setw(16) << "rows / s" << "checksum" << '\n';
+    for (unsigned threads : {1, 2, 4, 8}) {
+        auto start = std::chrono::steady_clock::now();
+        johnson_t j(large, threads);
+        auto mid = std::chrono::steady_clock::now();
+        std::atomic<long long> checksum{0};
+        j.run(sources, [&](int, const std::vector<long long>& row) {
+            long long sum = 0;
+            for (long long d : row) if (d != johnson_t::INF) sum += d;
+            checksum += sum;
+        });
+        auto end = std::chrono::steady_clock::now();
+        double rows_ms = std::chrono::duration<double, std::milli>(end - mid).count();
+        std::cout << std::setw(10) << threads << std::setw(18) << std::chrono::duration<double, std::milli>(mid - start).count()
+                  << std::setw(16) << rows_ms << std::setw(16) << count / rows_ms * 1000 << checksum << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <limits>
+#include <vector>
+#include <stdexcept>
+#include "Graph.h"
+#include "DijkstraEngine.h"
+#include "BellmanFordEngine.h"
+
+/* johnson's algorithm - all pairs shortest paths on sparse graphs with negative weights, O(EV + V * (E + V) log V)
+//   - bellman ford from a virtual source joined to every vertex by 0-weight edges gives potentials h(v) <= 0
+//   - reweighting w'(u, v) = w(u, v) + h(u) - h(v) makes every edge non-negative & keeps shortest paths unchanged
+//   - one dijkstra's per source on the reweighted graph, sources are spread over a thread pool with one engine per worker
+//   - rows are streamed to a callback as they finish, so the V^2 table never has to be materialized
+// note: throws std::invalid_argument if graph contains a negative cycle
+// @template
+//   - G: csr graph type (offsetArray(), targetArray() & weightArray() are used to build the augmented & reweighted graphs)
+*/
+template <typename G>
+class Johnson {
+    public:
+        typedef typename G::vertex_type V;
+        typedef typename G::weight_type W;
+
+        static constexpr W INF = std::numeric_limits<W>::max();
+
+    private:
+        std::size_t n;
+        std::vector<W> h; // vertex potentials
+        G reweighted;
+        ThreadPool pool;
+        std::vector<DijkstraEngine<G>> engines; // one per worker
+        std::vector<std::vector<W>> rows; // per-worker row buffer handed to callback
+
+        // bellman ford from virtual vertex n, which has a 0-weight edge to every vertex
+        void computePotentials(const G& graph) {
+            std::vector<std::size_t> offsets = graph.offsetArray();
+            std::vector<V> targets = graph.targetArray();
+            std::vector<W> weights = graph.weightArray();
+            for (std::size_t v = 0; v < n; v++) {
+                targets.push_back(v);
+                weights.push_back(0);
+            }
+            offsets.push_back(targets.size());
+            G augmented(std::move(offsets), std::move(targets), std::move(weights));
+            auto r = BellmanFordEngine<G>(augmented, pool.size()).run(n);
+            if (r.negative_cycle) throw std::invalid_argument("johnson's algorithm requires a graph without negative cycles");
+            h.assign(r.dist.begin(), r.dist.begin() + n);
+        }
+
+        void reweight(const G& graph) {
+            const auto& offsets = graph.offsetArray();
+            const auto& targets = graph.targetArray();
+            std::vector<W> weights = graph.weightArray();
+            parallelFor(0, n, [&](unsigned, std::size_t lo, std::size_t hi) {
+                for (std::size_t u = lo; u < hi; u++) {
+                    for (std::size_t i = offsets[u]; i < offsets[u + 1]; i++) {
+                        // clamps rounding error of floating weights, exact for integer weights
+                        W w = weights[i] + h[u] - h[targets[i]];
+                        weights[i] = w < 0 ? 0 : w;
+                    }
+                }
+            }, pool.size(), 1 << 12);
+            reweighted = G(offsets, targets, std::move(weights));
+        }
+
+    public:
+        Johnson(const G& graph, unsigned threads = defaultThreads()) : n(graph.vertexCount()), pool(threads) {
+            computePotentials(graph);
+            reweight(graph);
+            engines.reserve(pool.size());
+            for (unsigned t = 0; t < pool.size(); t++) engines.emplace_back(reweighted);
+            rows.assign(pool.size(), std::vector<W>(n));
+        }
+
+        // potential of vertex v (shortest distance from virtual source)
+        W potential(V v) const { return h[v]; }
+        const G& reweightedGraph() const { return reweighted; }
+
+        /* computes shortest distances from every vertex in sources, calls fn(src, row) once per source
+        //   - row[v] = distance src -> v in original weights (INF if unreachable), only valid during the call
+        //   - fn is called concurrently from worker threads, so it must synchronize any shared state itself
+        */
+        template <typename F>
+        void run(const std::vector<V>& sources, F&& fn) {
+            pool.run(sources.size(), [&](unsigned t, std::size_t i) {
+                V src = sources[i];
+                DijkstraEngine<G>& engine = engines[t];
+                std::vector<W>& row = rows[t];
+                engine.run(src);
+                for (std::size_t v = 0; v < n; v++) {
+                    W d = engine.distance(v);
+                    row[v] = d == INF ? INF : d - h[src] + h[v];
+                }
+                fn(src, (const std::vector<W>&) row);
+            });
+        }
+
+        // streams rows of every source vertex
+        template <typename F>
+        void run(F&& fn) {
+            std::vector<V> sources(n);
+            for (std::size_t v = 0; v < n; v++) sources[v] = v;
+            run(sources, fn);
+        }
+
+        // materializes distance rows of given (distinct) sources, row i belongs to sources[i]
+        std::vector<std::vector<W>> matrix(const std::vector<V>& sources) {
+            std::vector<std::vector<W>> result(sources.size());
+            std::vector<std::size_t> index(n);
+            for (std::size_t i = 0; i < sources.size(); i++) index[sources[i]] = i;
+            run(sources, [&](V src, const std::vector<W>& row) { result[index[src]] = row; });
+            return result;
+        }
+};
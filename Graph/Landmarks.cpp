@@ -0,0 +1,85 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Landmarks.h"
+#include "Generators.h"
+#include "BidirectionalDijkstra.h"
+
+typedef CSRGraph<int, double> graph_t;
+
+struct Result {
+    double ms_per_query = 0, settled_per_query = 0, checksum = 0;
+};
+
+// runs every query pair through a point to point engine, averaging latency & settled vertices
+template <typename Q>
+Result measure(const std::vector<std::pair<int, int>>& pairs, Q&& query) {
+    Result r;
+    auto start = std::chrono::steady_clock::now();
+    for (auto [s, t] : pairs) {
+        auto [d, settled] = query(s, t);
+        r.checksum += d;
+        r.settled_per_query += settled;
+    }
+    r.ms_per_query = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / pairs.size();
+    r.settled_per_query /= pairs.size();
+    return r;
+}
+
+void compare(const std::string& name, const graph_t& graph, int queries) {
+    std::mt19937 rng(7);
+    std::vector<std::pair<int, int>> pairs(queries);
+    for (auto& [s, t] : pairs) { s = rng() % graph.vertexCount(); t = rng() % graph.vertexCount(); }
+
+    DijkstraEngine<graph_t> dijkstra(graph);
+    BidirectionalDijkstra<graph_t> bidir(graph);
+    auto t0 = std::chrono::steady_clock::now();
+    Landmarks<graph_t> farthest(graph, 16, Landmarks<graph_t>::FARTHEST);
+    auto t1 = std::chrono::steady_clock::now();
+    Landmarks<graph_t> avoid(graph, 16, Landmarks<graph_t>::AVOID);
+    auto t2 = std::chrono::steady_clock::now();
+    AStarALT<graph_t> alt_farthest(graph, farthest), alt_avoid(graph, avoid);
+
+    std::vector<std::pair<std::string, Result>> results = {
+        {"dijkstra", measure(pairs, [&](int s, int t) { double d = dijkstra.runTo(s, t); return std::make_pair(d, dijkstra.settledCount()); })},
+        {"bidirectional", measure(pairs, [&](int s, int t) { double d = bidir.query(s, t); return std::make_pair(d, bidir.settledCount()); })},
+        {"alt farthest", measure(pairs, [&](int s, int t) { double d = alt_farthest.query(s, t); return std::make_pair(d, alt_farthest.settledCount()); })},
+        {"alt avoid", measure(pairs, [&](int s, int t) { double d = alt_avoid.query(s, t); return std::make_pair(d, alt_avoid.settledCount()); })},
+    };
+    std::cout << '\n' << name << " (n = " << graph.vertexCount() << ", m = " << graph.edgeCount() << "), landmark preprocessing: farthest "
+              << std::chrono::duration<double>(t1 - t0).count() << "s, avoid " << std::chrono::duration<double>(t2 - t1).count() << "s\n";
+    std::cout << std::left << std::setw(16) << "algorithm" << std::setw(16) << "ms/query" << std::setw(16) << "settled/query" << '\n';
+    for (auto& [algo, r] : results) {
+        if (r.checksum != results[0].second.checksum) std::cout << "distance mismatch!\n";
+        std::cout << std::setw(16) << algo << std::setw(16) << r.ms_per_query << std::setw(16) << r.settled_per_query << '\n';
+    }
+}
+
+// sample test case & benchmark for bidirectional dijkstra's & a* with landmarks
+int main() {
+    std::vector<edge> edges = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, 5}, {0, 4, 5}};
+    graph_t graph(edges, 5);
+    Landmarks<graph_t> landmarks(graph, 2);
+    landmarks.save("landmarks.alt");
+    Landmarks<graph_t> loaded = Landmarks<graph_t>::load("landmarks.alt", graph);
+    try {
+        Landmarks<graph_t>::load("landmarks.alt", graph_t(edges, 6));
+    } catch (const std::invalid_argument& e) {
+        std::cout << "stale tables rejected: " << e.what() << '\n';
+    }
+    try {
+        Landmarks<CSRGraph<int, float>>::load("landmarks.alt", CSRGraph<int, float>(edges, 5));
+    } catch (const std::runtime_error& e) {
+        std::cout << "wrong types rejected: " << e.what() << '\n';
+    }
+    std::remove("landmarks.alt");
+    BidirectionalDijkstra<graph_t> bidir(graph);
+    AStarALT<graph_t> astar(graph, loaded);
+    std::cout << "Vertex 1 to 4: bidirectional " << bidir.query(1, 4) << ", alt " << astar.query(1, 4) << ", path:";
+    for (int v : bidir.path()) std::cout << ' ' << v;
+    std::cout << '\n';
+
+    compare("grid", graph_t(gridGraph(400, 42), 400 * 400), 200);
+    compare("road-like", graph_t(geometricGraph(200000, 3, 42), 200000), 200);
+    return 0;
+}
@@ -0,0 +1,271 @@
+#pragma once
+#include <cstdio>
+#include <string>
+#include <random>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include "DijkstraEngine.h"
+
+/* alt (a*, landmarks & triangle inequality) preprocessing - stores distances to & from k landmark vertices
+//   - lower bound on dist(v, t) for every landmark L: dist(L, t) - dist(L, v) and dist(v, L) - dist(t, L)
+//   - farthest selection: each new landmark is the vertex farthest from all landmarks chosen so far
+//   - avoid selection: grows shortest path tree from random root, weighs vertices by how poorly current landmarks
+//     bound their distance, then walks from the heaviest landmark-free subtree down to a leaf
+// note: tables are stored vertex-major (k entries per vertex) so a bound touches two contiguous rows
+// @template
+//   - G: graph type providing vertexCount(), neighbors(v) & transpose() (e.g. CSRGraph)
+*/
+template <typename G>
+class Landmarks {
+    public:
+        typedef typename G::vertex_type V;
+        typedef typename G::weight_type W;
+
+        enum Selection { FARTHEST, AVOID };
+
+        static constexpr W INF = DijkstraEngine<G>::INF;
+
+    private:
+        std::size_t n;
+        std::vector<V> landmarks;
+        std::vector<W> from_table; // from_table[v * k + i] = dist(landmark i, v)
+        std::vector<W> to_table; // to_table[v * k + i] = dist(v, landmark i)
+
+        std::size_t k() const { return landmarks.size(); }
+
+        // fills column i of both tables using dijkstra's from landmark over graph & reverse graph
+        void addLandmark(V l, DijkstraEngine<G>& fwd, DijkstraEngine<G>& bwd) {
+            std::size_t i = landmarks.size(), old_k = landmarks.size(), new_k = old_k + 1;
+            landmarks.push_back(l);
+            std::vector<W> from(n * new_k), to(n * new_k);
+            fwd.run(l);
+            bwd.run(l);
+            for (std::size_t v = 0; v < n; v++) {
+                std::copy(from_table.begin() + v * old_k, from_table.begin() + (v + 1) * old_k, from.begin() + v * new_k);
+                std::copy(to_table.begin() + v * old_k, to_table.begin() + (v + 1) * old_k, to.begin() + v * new_k);
+                from[v * new_k + i] = fwd.distance(v);
+                to[v * new_k + i] = bwd.distance(v);
+            }
+            from_table.swap(from);
+            to_table.swap(to);
+        }
+
+        // vertex maximizing min distance to chosen landmarks (ignores unreachable vertices)
+        V farthestVertex() const {
+            V best = 0;
+            W best_dist = 0;
+            bool found = false; // no sentinel distance, so unsigned weights work too
+            for (std::size_t v = 0; v < n; v++) {
+                W mn = INF;
+                for (std::size_t i = 0; i < k(); i++)
+                    mn = std::min(mn, from_table[v * k() + i]);
+                if (mn != INF && (!found || mn > best_dist)) {
+                    found = true;
+                    best_dist = mn;
+                    best = v;
+                }
+            }
+            return best;
+        }
+
+        // avoid heuristic: picks leaf below the landmark-free subtree whose distances are worst covered by current bounds
+        V avoidVertex(V root, DijkstraEngine<G>& fwd) const {
+            fwd.run(root);
+            // orders settled vertices by distance so children are processed before parents
+            std::vector<V> order;
+            for (std::size_t v = 0; v < n; v++)
+                if (fwd.isSettled(v)) order.push_back(v);
+            std::sort(order.begin(), order.end(), [&](V a, V b) { return fwd.distance(a) < fwd.distance(b); });
+            std::vector<W> size(n, 0);
+            std::vector<bool> has_landmark(n, false);
+            for (V l : landmarks) has_landmark[l] = true;
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                V v = *it;
+                if (!has_landmark[v]) size[v] += fwd.distance(v) - lowerBound(root, v);
+                else size[v] = 0;
+                V p = fwd.parent(v);
+                if (p == -1) continue;
+                if (has_landmark[v]) has_landmark[p] = true;
+                size[p] += size[v];
+            }
+            for (std::size_t v = 0; v < n; v++)
+                if (has_landmark[v]) size[v] = 0;
+            V best = root;
+            for (V v : order)
+                if (size[v] > size[best]) best = v;
+            // descends to a leaf following the heaviest child
+            std::vector<V> heaviest(n, -1);
+            for (V v : order) {
+                V p = fwd.parent(v);
+                if (p != -1 && (heaviest[p] == -1 || size[v] > size[heaviest[p]])) heaviest[p] = v;
+            }
+            while (heaviest[best] != -1 && size[heaviest[best]] > 0)
+                best = heaviest[best];
+            return best;
+        }
+
+    public:
+        Landmarks() : n(0) {}
+
+        // selects k landmarks & computes their distance tables
+        Landmarks(const G& graph, std::size_t count, Selection selection = AVOID, unsigned seed = 42) : n(graph.vertexCount()) {
+            if (n == 0) return;
+            G reverse_graph = graph.transpose();
+            DijkstraEngine<G> fwd(graph), bwd(reverse_graph);
+            std::mt19937 rng(seed);
+            // first landmark is farthest vertex from a random start vertex
+            fwd.run(rng() % n);
+            V first = 0;
+            for (std::size_t v = 0; v < n; v++)
+                if (fwd.isSettled(v) && fwd.distance(v) > fwd.distance(first)) first = v;
+            addLandmark(first, fwd, bwd);
+            while (landmarks.size() < std::min(count, n)) {
+                V next = selection == FARTHEST ? farthestVertex() : avoidVertex(rng() % n, fwd);
+                if (std::find(landmarks.begin(), landmarks.end(), next) != landmarks.end()) next = farthestVertex();
+                if (std::find(landmarks.begin(), landmarks.end(), next) != landmarks.end()) break;
+                addLandmark(next, fwd, bwd);
+            }
+        }
+
+        const std::vector<V>& getLandmarks() const { return landmarks; }
+
+        // admissible lower bound on dist(v, t) via triangle inequality over all landmarks
+        W lowerBound(V v, V t) const {
+            W best = 0;
+            const W* fv = &from_table[v * k()], *ft = &from_table[t * k()];
+            const W* tv = &to_table[v * k()], *tt = &to_table[t * k()];
+            for (std::size_t i = 0; i < k(); i++) {
+                if (ft[i] != INF && fv[i] != INF) best = std::max(best, ft[i] - fv[i]);
+                if (tv[i] != INF && tt[i] != INF) best = std::max(best, tv[i] - tt[i]);
+            }
+            return best;
+        }
+
+        // writes landmark tables in binary format: magic, vertex & weight byte widths, weight kind, n, k, landmark ids,
+        // from table, to table
+        void save(const std::string& path) const {
+            std::FILE* file = std::fopen(path.c_str(), "wb");
+            if (!file) throw std::runtime_error("failed to open " + path);
+            std::uint16_t widths[2] = {sizeof(V), sizeof(W)};
+            std::uint64_t header[3] = {std::is_floating_point<W>::value, n, k()};
+            bool ok = std::fwrite("ALT2", 1, 4, file) == 4 && std::fwrite(widths, sizeof(widths), 1, file) == 1
+                && std::fwrite(header, sizeof(header), 1, file) == 1
+                && std::fwrite(landmarks.data(), sizeof(V), k(), file) == k()
+                && std::fwrite(from_table.data(), sizeof(W), from_table.size(), file) == from_table.size()
+                && std::fwrite(to_table.data(), sizeof(W), to_table.size(), file) == to_table.size();
+            ok = std::fclose(file) == 0 && ok;
+            if (!ok) throw std::runtime_error("failed to write " + path);
+        }
+
+        /* loads tables written by save for graph
+        //   - throws std::runtime_error if the file can't be read or was written for other vertex / weight types
+        //   - throws std::invalid_argument if the tables were built for a different vertex count
+        */
+        static Landmarks load(const std::string& path, const G& graph) {
+            std::FILE* file = std::fopen(path.c_str(), "rb");
+            if (!file) throw std::runtime_error("failed to open " + path);
+            Landmarks alt;
+            char magic[4];
+            std::uint16_t widths[2];
+            std::uint64_t header[3];
+            bool ok = std::fread(magic, 1, 4, file) == 4 && std::memcmp(magic, "ALT2", 4) == 0
+                && std::fread(widths, sizeof(widths), 1, file) == 1 && std::fread(header, sizeof(header), 1, file) == 1;
+            if (ok && (widths[0] != sizeof(V) || widths[1] != sizeof(W) || header[0] != std::is_floating_point<W>::value)) {
+                std::fclose(file);
+                throw std::runtime_error("landmark file " + path + " does not match requested vertex / weight types");
+            }
+            if (ok) {
+                alt.n = header[1];
+                alt.landmarks.resize(header[2]);
+                alt.from_table.resize(header[1] * header[2]);
+                alt.to_table.resize(header[1] * header[2]);
+                ok = std::fread(alt.landmarks.data(), sizeof(V), alt.landmarks.size(), file) == alt.landmarks.size()
+                    && std::fread(alt.from_table.data(), sizeof(W), alt.from_table.size(), file) == alt.from_table.size()
+                    && std::fread(alt.to_table.data(), sizeof(W), alt.to_table.size(), file) == alt.to_table.size();
+            }
+            std::fclose(file);
+            if (!ok) throw std::runtime_error("malformed landmark file " + path);
+            if (alt.n != graph.vertexCount())
+                throw std::invalid_argument("landmark file " + path + " has " + std::to_string(alt.n) + " vertices, graph has " +
+                                            std::to_string(graph.vertexCount()));
+            for (V l : alt.landmarks)
+                if (l < 0 || (std::size_t) l >= alt.n) throw std::runtime_error("malformed landmark file " + path);
+            return alt;
+        }
+};
+
+/* a* search with alt lower bounds - point to point shortest path
+//   - heap is keyed by dist(src, v) + lowerBound(v, dest), which steers search toward dest
+//   - alt bounds are consistent (feasible potentials), so each vertex is settled at most once like dijkstra's
+*/
+template <typename G>
+class AStarALT {
+    public:
+        typedef typename G::vertex_type V;
+        typedef typename G::weight_type W;
+
+        static constexpr W INF = DijkstraEngine<G>::INF;
+
+    private:
+        typedef std::pair<W, V> entry;
+
+        const G* graph;
+        const Landmarks<G>* alt;
+        std::vector<W> dist;
+        std::vector<V> bp;
+        std::vector<std::uint32_t> reached, settled;
+        std::vector<entry> min_heap;
+        std::uint32_t epoch;
+        std::size_t settled_count;
+
+    public:
+        AStarALT(const G& p_graph, const Landmarks<G>& p_alt)
+            : graph(&p_graph), alt(&p_alt), dist(p_graph.vertexCount()), bp(p_graph.vertexCount()),
+              reached(p_graph.vertexCount(), 0), settled(p_graph.vertexCount(), 0), epoch(0), settled_count(0) {}
+
+        // returns shortest distance from src to dest (INF if unreachable)
+        W query(V src, V dest) {
+            if (++epoch == 0) {
+                std::fill(reached.begin(), reached.end(), 0);
+                std::fill(settled.begin(), settled.end(), 0);
+                epoch = 1;
+            }
+            min_heap.clear();
+            settled_count = 0;
+            reached[src] = epoch;
+            dist[src] = 0;
+            bp[src] = -1;
+            min_heap.push_back({alt->lowerBound(src, dest), src});
+            while (!min_heap.empty()) {
+                std::pop_heap(min_heap.begin(), min_heap.end(), std::greater<entry>());
+                V curr = min_heap.back().second; min_heap.pop_back();
+                if (settled[curr] == epoch) continue;
+                settled[curr] = epoch;
+                settled_count++;
+                if (curr == dest) return dist[dest];
+                for (auto [next, weight] : graph->neighbors(curr)) {
+                    W d = dist[curr] + weight;
+                    if (settled[next] == epoch || (reached[next] == epoch && d >= dist[next])) continue;
+                    reached[next] = epoch;
+                    dist[next] = d;
+                    bp[next] = curr;
+                    min_heap.push_back({d + alt->lowerBound(next, dest), next});
+                    std::push_heap(min_heap.begin(), min_heap.end(), std::greater<entry>());
+                }
+            }
+            return INF;
+        }
+
+        std::size_t settledCount() const { return settled_count; }
+
+        // vertices along shortest path to dest found by last query
+        std::vector<V> path(V dest) const {
+            std::vector<V> path;
+            if (settled[dest] != epoch) return path;
+            for (V v = dest; v != -1; v = bp[v])
+                path.push_back(v);
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+};
@@ -0,0 +1,98 @@
+#include <queue>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "ManyToMany.h"
+
+typedef CSRGraph<int, double> graph_t;
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// baseline: same as dijkstras() in dijkstras.cpp, allocates fresh arrays & runs every query to completion
+std::vector<double> freshDijkstras(const graph_t& graph, int src) {
+    typedef std::pair<double, int> pdi;
+    std::vector<double> dist(graph.vertexCount(), DijkstraEngine<graph_t>::INF);
+    std::vector<int> bp(graph.vertexCount(), -1);
+    std::vector<bool> vis(graph.vertexCount(), false);
+    std::priority_queue<pdi, std::vector<pdi>, std::greater<pdi>> min_heap;
+    dist[src] = 0;
+    min_heap.push({0, src});
+    while (!min_heap.empty()) {
+        int curr = min_heap.top().second; min_heap.pop();
+        if (vis[curr]) continue;
+        vis[curr] = true;
+        for (auto [next, weight] : graph.neighbors(curr)) {
+            if (!vis[next] && dist[curr] + weight < dist[next]) {
+                dist[next] = dist[curr] + weight;
+                bp[next] = curr;
+                min_heap.push({dist[next], next});
+            }
+        }
+    }
+    return dist;
+}
+
+std::vector<int> randomVertices(std::size_t count, int n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<int> vertices(count);
+    for (auto& v : vertices) v = rng() % n;
+    return vertices;
+}
+
+// sample test case & benchmark for many-to-many distance tables
+int main() {
+    std::vector<edge> edges = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, 5}, {0, 4, 5}};
+    graph_t graph(edges, 5);
+    std::vector<int> sources = {0, 1}, targets = {2, 3, 4};
+    DistanceTable<double> sample = ManyToMany<graph_t>(graph).table(sources, targets);
+    std::cout << "Sample distance table:\n" << std::left << std::setw(6) << "";
+    for (int t : targets) std::cout << std::setw(6) << t;
+    std::cout << '\n';
+    for (std::size_t i = 0; i < sources.size(); i++) {
+        std::cout << std::setw(6) << sources[i];
+        for (std::size_t j = 0; j < targets.size(); j++) std::cout << std::setw(6) << sample.at(i, j);
+        std::cout << '\n';
+    }
+
+    // road-like grid: looping dijkstras() vs batched engine vs contraction hierarchy buckets
+    const int side = 200, n = side * side;
+    graph_t grid(gridGraph(side, 42), n);
+    auto start = std::chrono::steady_clock::now();
+    ContractionHierarchy<graph_t> ch(grid);
+    std::cout << "\ngrid " << side << " x " << side << ", hierarchy preprocessing: " << elapsed(start) << " ms\n"
+              << std::setw(26) << "method" << std::setw(16) << "sources" << std::setw(16) << "targets" << std::setw(14) << "time (ms)"
+              << std::setw(18) << "queries / s" << "mismatches" << '\n';
+    auto report = [&](const std::string& name, std::size_t s, std::size_t t, double ms, std::size_t mismatches) {
+        std::cout << std::setw(26) << name << std::setw(16) << s << std::setw(16) << t << std::setw(14) << ms << std::setw(18)
+                  << s / ms * 1000 << mismatches << '\n';
+    };
+    ManyToMany<graph_t> batch(grid);
+    ManyToManyCH<graph_t> buckets(ch);
+    for (auto [s, t] : {std::pair<std::size_t, std::size_t>{100, 1000}, {1000, 10000}}) {
+        sources = randomVertices(s, n, 1);
+        targets = randomVertices(t, n, 2);
+        start = std::chrono::steady_clock::now();
+        DistanceTable<double> expected = batch.table(sources, targets);
+        double batch_ms = elapsed(start);
+        if (s <= 100) {
+            start = std::chrono::steady_clock::now();
+            std::size_t mismatches = 0;
+            for (std::size_t i = 0; i < s; i++) {
+                std::vector<double> dist = freshDijkstras(grid, sources[i]);
+                for (std::size_t j = 0; j < t; j++) mismatches += dist[targets[j]] != expected.at(i, j);
+            }
+            report("looping dijkstras()", s, t, elapsed(start), mismatches);
+        }
+        report("batched engine", s, t, batch_ms, 0);
+        start = std::chrono::steady_clock::now();
+        DistanceTable<double> table = buckets.table(sources, targets);
+        double ch_ms = elapsed(start);
+        std::size_t mismatches = 0;
+        for (std::size_t k = 0; k < table.data.size(); k++) mismatches += table.data[k] != expected.data[k];
+        report("hierarchy buckets", s, t, ch_ms, mismatches);
+    }
+    return 0;
+}
@@ -0,0 +1,169 @@
+#pragma once
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include "Graph.h"
+#include "DijkstraEngine.h"
+#include "ContractionHierarchy.h"
+
+// dense row-major distance table, row i belongs to sources[i] & column j to targets[j]
+template <typename W>
+struct DistanceTable {
+    std::size_t rows = 0, cols = 0;
+    std::vector<W> data;
+
+    DistanceTable() {}
+    DistanceTable(std::size_t p_rows, std::size_t p_cols, W fill) : rows(p_rows), cols(p_cols), data(p_rows * p_cols, fill) {}
+
+    W& at(std::size_t i, std::size_t j) { return data[i * cols + j]; }
+    const W& at(std::size_t i, std::size_t j) const { return data[i * cols + j]; }
+    W* row(std::size_t i) { return data.data() + i * cols; }
+};
+
+/* batched many-to-many distances - one dijkstra's per source, spread over a thread pool
+//   - each worker owns a DijkstraEngine, so scratch arrays are allocated once & reset in O(touched) between queries
+//   - every search stops as soon as all targets are settled
+// @template
+//   - G: graph type providing vertexCount() & neighbors(v) (e.g. CSRGraph or MappedGraph)
+*/
+template <typename G>
+class ManyToMany {
+    public:
+        typedef typename G::vertex_type V;
+        typedef typename G::weight_type W;
+
+        static constexpr W INF = std::numeric_limits<W>::max();
+
+    private:
+        ThreadPool pool;
+        std::vector<DijkstraEngine<G>> engines; // one per worker
+
+    public:
+        ManyToMany(const G& graph, unsigned threads = defaultThreads()) : pool(threads) {
+            engines.reserve(pool.size());
+            for (unsigned t = 0; t < pool.size(); t++) engines.emplace_back(graph);
+        }
+
+        // distance table from every source to every target (INF if unreachable)
+        DistanceTable<W> table(const std::vector<V>& sources, const std::vector<V>& targets) {
+            DistanceTable<W> result(sources.size(), targets.size(), INF);
+            pool.run(sources.size(), [&](unsigned t, std::size_t i) {
+                DijkstraEngine<G>& engine = engines[t];
+                engine.runTo(sources[i], targets);
+                W* row = result.row(i);
+                for (std::size_t j = 0; j < targets.size(); j++) row[j] = engine.distance(targets[j]);
+            });
+            return result;
+        }
+};
+
+/* bucket-based many-to-many distances over a contraction hierarchy (knopp et al.)
+//   - backward upward search from every target t (downward arcs): each settled vertex u gets bucket entry (t, d(u, t))
+//   - forward upward search from every source s (upward arcs): for each settled u & entry (t, d) in u's bucket,
+//     table[s][t] = min(table[s][t], d(s, u) + d)
+//   - upward search spaces are small, so the cost is roughly (|S| + |T|) searches plus bucket scans instead of |S| full searches
+//   - stall on demand skips vertices reached suboptimally, which keeps both search spaces & the buckets smaller
+//   - both search phases run on a thread pool, bucket entries are gathered per worker & then grouped by vertex
+*/
+template <typename G>
+class ManyToManyCH {
+    public:
+        typedef typename G::vertex_type V;
+        typedef typename G::weight_type W;
+
+        static constexpr W INF = std::numeric_limits<W>::max();
+
+    private:
+        typedef std::pair<W, V> entry;
+
+        // exhaustive dijkstra's over upward (forward) or downward (backward) arcs with epoch-stamped scratch
+        struct UpwardSearch {
+            std::vector<W> dist;
+            std::vector<std::uint32_t> reached, settled;
+            std::vector<entry> min_heap;
+            std::uint32_t epoch = 0;
+
+            UpwardSearch(std::size_t n) : dist(n), reached(n, 0), settled(n, 0) {}
+
+            // calls fn(v, distance) for every vertex settled by upward search from src
+            template <typename F>
+            void run(const ContractionHierarchy<G>& ch, V src, bool forward, F&& fn) {
+                if (++epoch == 0) {
+                    std::fill(reached.begin(), reached.end(), 0);
+                    std::fill(settled.begin(), settled.end(), 0);
+                    epoch = 1;
+                }
+                min_heap.clear();
+                reached[src] = epoch;
+                dist[src] = 0;
+                min_heap.push_back({0, src});
+                auto relax = [&](V next, W weight, W d) {
+                    if (reached[next] == epoch && d + weight >= dist[next]) return;
+                    reached[next] = epoch;
+                    dist[next] = d + weight;
+                    min_heap.push_back({d + weight, next});
+                    std::push_heap(min_heap.begin(), min_heap.end(), std::greater<entry>());
+                };
+                while (!min_heap.empty()) {
+                    std::pop_heap(min_heap.begin(), min_heap.end(), std::greater<entry>());
+                    auto [d, curr] = min_heap.back(); min_heap.pop_back();
+                    if (settled[curr] == epoch || d != dist[curr]) continue;
+                    settled[curr] = epoch;
+                    // stall on demand: a higher ranked vertex already gives a shorter path, so d isn't a shortest distance
+                    bool stalled = false;
+                    auto check = [&](V prev, W weight) { stalled = stalled || (reached[prev] == epoch && dist[prev] + weight < d); };
+                    if (forward) ch.forEachDownArc(curr, check);
+                    else ch.forEachUpArc(curr, check);
+                    if (stalled) continue;
+                    fn(curr, d);
+                    if (forward) ch.forEachUpArc(curr, [&](V next, W weight) { relax(next, weight, d); });
+                    else ch.forEachDownArc(curr, [&](V next, W weight) { relax(next, weight, d); });
+                }
+            }
+        };
+
+        struct BucketEntry { V vertex; std::uint32_t target; W dist; };
+
+        const ContractionHierarchy<G>* ch;
+        ThreadPool pool;
+        std::vector<UpwardSearch> searches; // one per worker
+
+    public:
+        ManyToManyCH(const ContractionHierarchy<G>& p_ch, unsigned threads = defaultThreads()) : ch(&p_ch), pool(threads) {
+            searches.reserve(pool.size());
+            for (unsigned t = 0; t < pool.size(); t++) searches.emplace_back(ch->vertexCount());
+        }
+
+        DistanceTable<W> table(const std::vector<V>& sources, const std::vector<V>& targets) {
+            std::size_t n = ch->vertexCount();
+            std::vector<std::vector<BucketEntry>> local(pool.size());
+            pool.run(targets.size(), [&](unsigned t, std::size_t j) {
+                searches[t].run(*ch, targets[j], false, [&](V v, W d) { local[t].push_back({v, (std::uint32_t) j, d}); });
+            });
+            // groups bucket entries by vertex (counting sort)
+            std::vector<std::size_t> offsets(n + 1, 0);
+            for (const auto& l : local)
+                for (const auto& e : l) offsets[e.vertex + 1]++;
+            for (std::size_t v = 0; v < n; v++) offsets[v + 1] += offsets[v];
+            std::vector<std::pair<std::uint32_t, W>> buckets(offsets[n]);
+            std::vector<std::size_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (auto& l : local) {
+                for (const auto& e : l) buckets[cursor[e.vertex]++] = {e.target, e.dist};
+                std::vector<BucketEntry>().swap(l);
+            }
+
+            DistanceTable<W> result(sources.size(), targets.size(), INF);
+            pool.run(sources.size(), [&](unsigned t, std::size_t i) {
+                W* row = result.row(i);
+                searches[t].run(*ch, sources[i], true, [&](V v, W d) {
+                    for (std::size_t k = offsets[v]; k < offsets[v + 1]; k++) {
+                        auto [j, dt] = buckets[k];
+                        row[j] = std::min(row[j], d + dt);
+                    }
+                });
+            });
+            return result;
+        }
+};
@@ -0,0 +1,88 @@
+#include <chrono>
+#include <numeric>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "MinimumSpanningForest.h"
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// sequential baseline: std::sort + kruskal's with a plain union find (union by index, path halving)
+std::vector<edge> sortKruskal(std::vector<edge> edges, int n) {
+    std::sort(edges.begin(), edges.end(), detail::lighterEdge);
+    std::vector<int> parent(n);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&](int v) {
+        while (parent[v] != v) v = parent[v] = parent[parent[v]];
+        return v;
+    };
+    std::vector<edge> forest;
+    for (const auto& e : edges) {
+        int u = find(e.from), v = find(e.to);
+        if (u == v) continue;
+        parent[std::max(u, v)] = std::min(u, v);
+        forest.push_back(e);
+    }
+    return forest;
+}
+
+double totalWeight(const std::vector<edge>& forest) {
+    double total = 0;
+    for (const auto& e : forest) total += e.weight;
+    return total;
+}
+
+// sample test case & throughput of boruvka vs filter kruskal vs std::sort kruskal on 10M+ edge graphs
+int main() {
+    std::vector<edge> sample = {{0, 1, 4}, {1, 2, 1}, {0, 2, 3}, {2, 3, 2}, {1, 3, 5}, {4, 5, 7}, {5, 5, 1}};
+    std::cout << std::left << std::setw(10) << "Edge" << "Weight" << '\n';
+    for (const auto& e : filterKruskal(sample, 6)) std::cout << std::setw(10) << std::to_string(e.from) + " - " + std::to_string(e.to) << e.weight << '\n';
+    std::cout << "boruvka total " << totalWeight(boruvka(sample, 6)) << ", filter kruskal total " << totalWeight(filterKruskal(sample, 6)) << '\n';
+
+    // parallel duplicates: ranges of identical edges larger than the base case threshold must not be recursed on again
+    std::vector<edge> duplicates(5000, edge(0, 1, 1));
+    duplicates.push_back({1, 2, 2});
+    std::vector<edge> pair = {{0, 1, 1}, {0, 1, 1}};
+    std::cout << "duplicates: sort kruskal " << sortKruskal(duplicates, 3).size() << " edges, boruvka "
+              << boruvka(duplicates, 3).size() << ", filter kruskal " << filterKruskal(duplicates, 3).size() << " (threshold 1: "
+              << filterKruskal(duplicates, 3, 1, 1).size() << ", pair " << filterKruskal(pair, 3, 1, 1).size() << ")\n";
+
+    const int scale = 21, n = 1 << scale;
+    std::vector<unsigned> thread_counts;
+    for (unsigned t = 1; t < defaultThreads(); t *= 2) thread_counts.push_back(t);
+    thread_counts.push_back(defaultThreads());
+    std::cout << '\n' << std::setw(16) << "graph" << std::setw(18) << "method" << std::setw(10) << "threads" << std::setw(12) << "ms"
+              << std::setw(14) << "M edges/s" << std::setw(12) << "forest" << std::setw(16) << "total weight" << "same" << '\n';
+    for (int family = 0; family < 4; family++) {
+        std::string name;
+        std::vector<edge> edges;
+        int vertices = n;
+        if (family == 0) { name = "grid 2048x2048"; vertices = 2048 * 2048; edges = gridGraph(2048, 42); }
+        if (family == 1) { name = "geometric 2M"; edges = geometricGraph(n, 4, 42); }
+        if (family == 2) { name = "erdos-renyi 2M"; edges = erdosRenyiGraph(n, 8ull * n, 42); }
+        if (family == 3) { name = "r-mat 2^21"; edges = rmatGraph(scale, 8ull * n, 42); }
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<edge> forest = sortKruskal(edges, vertices);
+        double ms = elapsed(start), expected = totalWeight(forest);
+        std::size_t size = forest.size();
+        auto report = [&](const std::string& method, unsigned threads, double ms, const std::vector<edge>& forest) {
+            double total = totalWeight(forest);
+            std::cout << std::setw(16) << name << std::setw(18) << method << std::setw(10) << threads << std::setw(12) << ms
+                      << std::setw(14) << edges.size() / ms / 1e3 << std::setw(12) << forest.size() << std::setw(16) << std::setprecision(12)
+                      << total << std::setprecision(6) << (total == expected && forest.size() == size ? "yes" : "no") << '\n';
+        };
+        report("sort kruskal", 1, ms, forest);
+        for (unsigned threads : thread_counts) {
+            start = std::chrono::steady_clock::now();
+            forest = boruvka(edges, vertices, threads);
+            report("boruvka", threads, elapsed(start), forest);
+            start = std::chrono::steady_clock::now();
+            forest = filterKruskal(edges, vertices, threads);
+            report("filter kruskal", threads, elapsed(start), forest);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,195 @@
+#pragma once
+#include <atomic>
+#include <random>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include "Graph.h"
+#include "../Sorting/generic_sort.h"
+
+/* minimum spanning forest - both take the shared edge set & return the forest edges (one tree per component)
+//   - edges are treated as undirected, self loops are skipped, u -> v & v -> u may both be present
+//   - ties between equal weights are broken by a fixed total order (edge index for boruvka, endpoints for kruskal),
+//     so forests may differ on ties but always have the same minimum total weight
+*/
+
+/* lock free union find - parent pointers in one atomic array
+//   - unite hooks the larger root under the smaller with a compare & swap, which only succeeds while that root is
+//     still a root, so concurrent unions never form a cycle & exactly one of two racing unions of a pair returns true
+//   - find halves paths as it walks, stale writes are harmless since they still point at an ancestor
+*/
+template <typename V = int>
+class ConcurrentUnionFind {
+    private:
+        std::vector<std::atomic<V>> parent;
+
+    public:
+        explicit ConcurrentUnionFind(std::size_t n) : parent(n) {
+            for (std::size_t v = 0; v < n; v++) parent[v].store((V) v, std::memory_order_relaxed);
+        }
+
+        V find(V v) {
+            while (true) {
+                V p = parent[v].load(std::memory_order_relaxed), gp = parent[p].load(std::memory_order_relaxed);
+                if (p == gp) return p;
+                parent[v].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+                v = gp;
+            }
+        }
+
+        // merges sets of u & v, returns false if they were already one set
+        bool unite(V u, V v) {
+            while (true) {
+                u = find(u);
+                v = find(v);
+                if (u == v) return false;
+                if (u < v) std::swap(u, v);
+                V expected = u;
+                if (parent[u].compare_exchange_strong(expected, v, std::memory_order_relaxed)) return true;
+            }
+        }
+
+        bool same(V u, V v) { return find(u) == find(v); }
+        std::size_t size() const { return parent.size(); }
+};
+
+/* parallel boruvka - every round each component picks its lightest outgoing edge, then all picks are united at once
+//   - picks are made with a compare & swap loop on best[root] (weight, then edge index), so picks form a forest &
+//     the edge two components both picked is added by whichever unite succeeds
+//   - edges found inside one component are dropped from the active list, so later rounds scan fewer edges
+//   - time complexity O(E log V) work, O(log V) rounds
+*/
+inline std::vector<edge> boruvka(const std::vector<edge>& edges, int n, unsigned threads = defaultThreads()) {
+    const std::size_t NONE = std::numeric_limits<std::size_t>::max();
+    auto lighter = [&](std::size_t i, std::size_t j) {
+        return edges[i].weight < edges[j].weight || (edges[i].weight == edges[j].weight && i < j);
+    };
+    ConcurrentUnionFind<int> sets(n);
+    std::vector<std::atomic<std::size_t>> best(n);
+    for (int v = 0; v < n; v++) best[v].store(NONE, std::memory_order_relaxed);
+    std::vector<std::size_t> active, next;
+    active.reserve(edges.size());
+    for (std::size_t i = 0; i < edges.size(); i++)
+        if (edges[i].from != edges[i].to) active.push_back(i);
+    std::vector<char> keep;
+    std::vector<std::vector<edge>> local(threads);
+    std::vector<edge> forest;
+
+    auto pick = [&](int c, std::size_t i) {
+        std::size_t curr = best[c].load(std::memory_order_relaxed);
+        while (curr == NONE || lighter(i, curr)) {
+            if (best[c].compare_exchange_weak(curr, i, std::memory_order_relaxed)) return;
+        }
+    };
+
+    while (!active.empty()) {
+        keep.assign(active.size(), 0);
+        parallelFor(0, active.size(), [&](unsigned, std::size_t lo, std::size_t hi) {
+            for (std::size_t k = lo; k < hi; k++) {
+                const edge& e = edges[active[k]];
+                int cu = sets.find(e.from), cv = sets.find(e.to);
+                if (cu == cv) continue;
+                keep[k] = 1;
+                pick(cu, active[k]);
+                pick(cv, active[k]);
+            }
+        }, threads);
+
+        parallelFor(0, n, [&](unsigned t, std::size_t lo, std::size_t hi) {
+            for (std::size_t c = lo; c < hi; c++) {
+                std::size_t i = best[c].load(std::memory_order_relaxed);
+                if (i == NONE) continue;
+                best[c].store(NONE, std::memory_order_relaxed);
+                if (sets.unite(edges[i].from, edges[i].to)) local[t].push_back(edges[i]);
+            }
+        }, threads);
+        for (auto& l : local) {
+            forest.insert(forest.end(), l.begin(), l.end());
+            l.clear();
+        }
+
+        // compacts active edges: per chunk counts, then every chunk copies its kept edges to its offset
+        std::vector<std::size_t> counts(threads + 1, 0);
+        parallelFor(0, active.size(), [&](unsigned t, std::size_t lo, std::size_t hi) {
+            for (std::size_t k = lo; k < hi; k++) counts[t + 1] += keep[k];
+        }, threads);
+        for (unsigned t = 0; t < threads; t++) counts[t + 1] += counts[t];
+        next.resize(counts[threads]);
+        parallelFor(0, active.size(), [&](unsigned t, std::size_t lo, std::size_t hi) {
+            std::size_t pos = counts[t];
+            for (std::size_t k = lo; k < hi; k++)
+                if (keep[k]) next[pos++] = active[k];
+        }, threads);
+        active.swap(next);
+    }
+    return forest;
+}
+
+namespace detail {
+    // lighter edge first, ties broken by endpoints so the order is total
+    inline bool lighterEdge(const edge& a, const edge& b) {
+        if (a.weight != b.weight) return a.weight < b.weight;
+        if (a.from != b.from) return a.from < b.from;
+        return a.to < b.to;
+    }
+
+    // kruskal's on edges[l..r]: sorts them & adds every edge that joins two sets
+    inline void kruskal(std::vector<edge>& edges, std::ptrdiff_t l, std::ptrdiff_t r, ConcurrentUnionFind<int>& sets,
+                        std::vector<edge>& forest) {
+        generic::quicksort(edges, l, r, lighterEdge);
+        for (std::ptrdiff_t i = l; i <= r; i++)
+            if (sets.unite(edges[i].from, edges[i].to)) forest.push_back(edges[i]);
+    }
+
+    // moves edges of edges[l..r] whose endpoints are still in different sets to the front, returns new r
+    inline std::ptrdiff_t filterConnected(std::vector<edge>& edges, std::ptrdiff_t l, std::ptrdiff_t r, ConcurrentUnionFind<int>& sets,
+                                          std::vector<char>& keep, unsigned threads) {
+        if (r < l) return r;
+        keep.assign(r - l + 1, 0);
+        parallelFor(0, keep.size(), [&](unsigned, std::size_t lo, std::size_t hi) {
+            for (std::size_t k = lo; k < hi; k++) keep[k] = !sets.same(edges[l + k].from, edges[l + k].to);
+        }, threads);
+        std::ptrdiff_t out = l;
+        for (std::size_t k = 0; k < keep.size(); k++)
+            if (keep[k]) edges[out++] = edges[l + k];
+        return out - 1;
+    }
+
+    inline void filterKruskal(std::vector<edge>& edges, std::ptrdiff_t l, std::ptrdiff_t r, ConcurrentUnionFind<int>& sets,
+                              std::vector<edge>& forest, std::vector<char>& keep, std::mt19937_64& rng, unsigned threads,
+                              std::ptrdiff_t threshold) {
+        if (r - l + 1 <= threshold) {
+            kruskal(edges, l, r, sets, forest);
+            return;
+        }
+        std::ptrdiff_t pivot = l + (std::ptrdiff_t) (rng() % (r - l + 1));
+        // copies of the pivot edge sit in [lt, gt], only the first can join two sets
+        auto [lt, gt] = generic::partition3(edges, l, r, pivot, lighterEdge);
+        filterKruskal(edges, l, lt - 1, sets, forest, keep, rng, threads, threshold);
+        if (sets.unite(edges[lt].from, edges[lt].to)) forest.push_back(edges[lt]);
+        r = filterConnected(edges, gt + 1, r, sets, keep, threads);
+        filterKruskal(edges, gt + 1, r, sets, forest, keep, rng, threads, threshold);
+    }
+}
+
+/* filter kruskal (osipov, sanders & singler) - kruskal's without sorting edges that can't be in the forest
+//   - partitions edges three ways around a random pivot (Sorting partition3), solves the light part first, adds the
+//     pivot edge (duplicates of it are dropped), then drops heavy edges whose endpoints are already connected &
+//     recurses on what is left
+//   - ranges of at most threshold edges are sorted (Sorting quicksort) & scanned like plain kruskal's
+//   - filtering is the parallel part (one find pair per edge), partitioning & uniting are sequential
+//   - time complexity O(E + V log V log (E / V)) expected on random weights instead of O(E log E)
+*/
+inline std::vector<edge> filterKruskal(std::vector<edge> edges, int n, unsigned threads = defaultThreads(), std::ptrdiff_t threshold = 1 << 12) {
+    std::size_t loops = 0;
+    for (std::size_t i = 0; i < edges.size(); i++)
+        if (edges[i].from == edges[i].to) loops++;
+        else edges[i - loops] = edges[i];
+    edges.erase(edges.end() - loops, edges.end());
+    ConcurrentUnionFind<int> sets(n);
+    std::vector<edge> forest;
+    std::vector<char> keep;
+    std::mt19937_64 rng(5489);
+    detail::filterKruskal(edges, 0, (std::ptrdiff_t) edges.size() - 1, sets, forest, keep, rng, threads, threshold);
+    return forest;
+}
@@ -0,0 +1,79 @@
+#include <cmath>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "NegativeCycle.h"
+#include "BellmanFordEngine.h"
+
+typedef CSRGraph<int, double> graph_t;
+
+void printCycle(const NegativeCycle<graph_t>& cycle) {
+    if (!cycle.found) {
+        std::cout << "No negative cycle detected!" << '\n';
+        return;
+    }
+    double total = 0;
+    for (const auto& e : cycle.edges) total += e.weight;
+    std::cout << "Negative cycle (weight " << total << "): ";
+    for (int v : cycle.vertices) std::cout << v << " -> ";
+    std::cout << cycle.vertices[0] << '\n';
+}
+
+// sample test cases & benchmark for negative cycle extraction
+int main() {
+    // same graph as bellman ford sample
+    int n = 8;
+    std::vector<edge> edges = {{0, 1, 2}, {0, 4, 3}, {0, 5, 6}, {1, 2, 1}, {2, 3, 4}, {3, 1, -7}, {4, 5, 1}, {5, 7, 2}, {6, 7, -2}};
+    graph_t graph(edges, n);
+    NegativeCycle<graph_t> cycle(graph, 0);
+    printCycle(cycle);
+    std::vector<bool> affected = markReachable(graph, cycle.vertices);
+    std::cout << "Vertices with -INF distance:";
+    for (int v = 0; v < n; v++) if (affected[v]) std::cout << ' ' << v;
+    std::cout << '\n';
+
+    // arbitrage: exchange rate r(a, b) becomes edge weight -log r, so a cycle with rate product > 1 is negative
+    std::vector<std::string> currency = {"USD", "EUR", "GBP", "JPY"};
+    double rates[4][4] = {{1, 0.92, 0.79, 151.2}, {1.09, 1, 0.86, 164.9}, {1.27, 1.17, 1, 192.1}, {0.0066, 0.0061, 0.0052, 1}};
+    std::vector<edge> fx;
+    for (int a = 0; a < 4; a++)
+        for (int b = 0; b < 4; b++)
+            if (a != b) fx.push_back({a, b, -std::log(rates[a][b])});
+    NegativeCycle<graph_t> arbitrage(graph_t(fx, 4));
+    if (arbitrage.found) {
+        double product = 1;
+        std::cout << "Arbitrage: ";
+        for (std::size_t i = 0; i < arbitrage.vertices.size(); i++) {
+            std::cout << currency[arbitrage.vertices[i]] << " -> ";
+            product *= std::exp(-arbitrage.edges[i].weight);
+        }
+        std::cout << currency[arbitrage.vertices[0]] << " (x" << product << ")\n";
+    }
+
+    // detection time against bellman ford (passes run all |V| passes once a cycle exists) with one planted negative cycle
+    std::cout << '\n' << std::left << std::setw(12) << "n" << std::setw(20) << "passes (ms)" << std::setw(20) << "spfa (ms)"
+              << std::setw(24) << "disassembly (ms)" << "cycle length" << '\n';
+    for (int size : {1000, 2000, 5000}) {
+        std::vector<edge> random = erdosRenyiGraph(size, 8ull * size, 42, 1, 100);
+        std::mt19937 rng(size);
+        std::vector<int> ring(20);
+        for (auto& v : ring) v = rng() % size;
+        for (std::size_t i = 0; i < ring.size(); i++)
+            random.push_back({ring[i], ring[(i + 1) % ring.size()], -10});
+        graph_t g(random, size);
+        BellmanFordEngine<graph_t> engine(g);
+        auto t0 = std::chrono::steady_clock::now();
+        bool a = engine.run(ring[0], BellmanFordEngine<graph_t>::PASSES).negative_cycle;
+        auto t1 = std::chrono::steady_clock::now();
+        bool b = engine.run(ring[0], BellmanFordEngine<graph_t>::SPFA).negative_cycle;
+        auto t2 = std::chrono::steady_clock::now();
+        NegativeCycle<graph_t> c(g, ring[0]);
+        auto t3 = std::chrono::steady_clock::now();
+        if (!a || !b || !c.found) std::cout << "cycle not detected!\n";
+        std::cout << std::setw(12) << size << std::setw(20) << std::chrono::duration<double, std::milli>(t1 - t0).count()
+                  << std::setw(20) << std::chrono::duration<double, std::milli>(t2 - t1).count()
+                  << std::setw(24) << std::chrono::duration<double, std::milli>(t3 - t2).count() << c.vertices.size() << '\n';
+    }
+    return 0;
+}
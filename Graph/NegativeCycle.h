@@ -0,0 +1,129 @@
+#pragma once
+#include <deque>
+#include <limits>
+#include <vector>
+#include "Graph.h"
+
+/* negative cycle detection via subtree disassembly (tarjan) - worst case O(EV), usually stops far earlier
+//   - runs fifo bellman ford while maintaining the shortest path tree as a preorder list with depths
+//   - when v's distance improves through u, v's old subtree is removed from the tree before v is reattached under u;
+//     if u is found inside that subtree, the tree edge u -> v closes a cycle of negative total weight
+//   - removed descendants have stale distances, so they're skipped until their distance improves again
+//   - cycle is reported the moment it appears in the parent graph instead of after |V| passes
+// @params
+//   - graph: csr graph, src: source vertex, or -1 to search the whole graph (every vertex starts at distance 0)
+*/
+template <typename G>
+struct NegativeCycle {
+    typedef typename G::vertex_type V;
+    typedef typename G::weight_type W;
+
+    bool found = false;
+    std::vector<V> vertices; // cycle vertices in order, edge i leads from vertices[i] to vertices[(i + 1) % size]
+    std::vector<edge> edges; // cycle edges with weights
+    std::size_t scans = 0; // vertices scanned before detection
+
+    NegativeCycle(const G& graph, V src = -1) {
+        std::size_t n = graph.vertexCount();
+        const W INF = std::numeric_limits<W>::max();
+        const V root = n; // virtual root of shortest path tree (parent of source vertices)
+        std::vector<W> dist(n, INF), parent_weight(n, 0);
+        std::vector<V> parent(n + 1, -1);
+        std::vector<V> next(n + 1), prev(n + 1); // circular preorder list of tree vertices, starting at root
+        std::vector<std::size_t> depth(n + 1, 0);
+        std::vector<bool> in_tree(n + 1, false), queued(n, false);
+        std::deque<V> queue;
+        next[root] = prev[root] = root;
+        in_tree[root] = true;
+
+        // inserts v directly after u in preorder (as u's first child)
+        auto attach = [&](V v, V u) {
+            next[v] = next[u];
+            prev[v] = u;
+            prev[next[u]] = v;
+            next[u] = v;
+            parent[v] = u;
+            depth[v] = depth[u] + 1;
+            in_tree[v] = true;
+        };
+
+        for (std::size_t v = 0; v < n; v++) {
+            if (src != -1 && (V) v != src) continue;
+            dist[v] = 0;
+            attach(v, root);
+            queued[v] = true;
+            queue.push_back(v);
+        }
+
+        while (!queue.empty()) {
+            V u = queue.front(); queue.pop_front();
+            queued[u] = false;
+            if (!in_tree[u]) continue;
+            scans++;
+            for (auto [v, weight] : graph.neighbors(u)) {
+                W d = dist[u] + weight;
+                if (d >= dist[v]) continue;
+                dist[v] = d;
+                if (in_tree[v]) {
+                    // disassembles v's subtree (v & every following vertex of greater depth in preorder)
+                    V w = next[v];
+                    while (w != root && depth[w] > depth[v]) {
+                        if (w == u) {
+                            extract(u, v, weight, parent, parent_weight);
+                            return;
+                        }
+                        in_tree[w] = false;
+                        w = next[w];
+                    }
+                    if (v == u) {
+                        extract(u, v, weight, parent, parent_weight);
+                        return;
+                    }
+                    next[prev[v]] = w;
+                    prev[w] = prev[v];
+                }
+                attach(v, u);
+                parent_weight[v] = weight;
+                if (!queued[v]) {
+                    queued[v] = true;
+                    queue.push_back(v);
+                }
+            }
+        }
+    }
+
+    private:
+        // cycle is v -> ... -> u along tree edges, closed by edge u -> v
+        void extract(V u, V v, W weight, const std::vector<V>& parent, const std::vector<W>& parent_weight) {
+            found = true;
+            for (V w = u; w != v; w = parent[w]) {
+                vertices.push_back(w);
+                edges.push_back({parent[w], w, (double) parent_weight[w]});
+            }
+            vertices.push_back(v);
+            std::reverse(vertices.begin(), vertices.end());
+            std::reverse(edges.begin(), edges.end());
+            edges.push_back({u, v, (double) weight});
+        }
+};
+
+// marks every vertex reachable from a set of start vertices (e.g. a negative cycle) using an explicit stack
+template <typename G>
+std::vector<bool> markReachable(const G& graph, const std::vector<typename G::vertex_type>& start) {
+    std::vector<bool> vis(graph.vertexCount(), false);
+    std::vector<typename G::vertex_type> stack;
+    for (auto v : start) {
+        if (vis[v]) continue;
+        vis[v] = true;
+        stack.push_back(v);
+    }
+    while (!stack.empty()) {
+        auto curr = stack.back(); stack.pop_back();
+        for (auto [next, weight] : graph.neighbors(curr)) {
+            if (vis[next]) continue;
+            vis[next] = true;
+            stack.push_back(next);
+        }
+    }
+    return vis;
+}
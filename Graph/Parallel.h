@@ -0,0 +1,109 @@
+#pragma once
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <condition_variable>
+
+// number of worker threads used by parallel graph algorithms (at least 1)
+inline unsigned defaultThreads() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// splits [begin, end) into one contiguous chunk per thread & calls fn(thread id, chunk begin, chunk end)
+// note: runs inline on calling thread when only one thread is requested or range is small
+template <typename F>
+void parallelFor(std::size_t begin, std::size_t end, F&& fn, unsigned threads = defaultThreads(), std::size_t min_chunk = 1 << 14) {
+    if (begin >= end) return;
+    std::size_t len = end - begin;
+    threads = (unsigned) std::max<std::size_t>(1, std::min<std::size_t>(threads, len / min_chunk));
+    if (threads == 1) {
+        fn(0u, begin, end);
+        return;
+    }
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        std::size_t lo = begin + len * t / threads, hi = begin + len * (t + 1) / threads;
+        workers.emplace_back([&fn, t, lo, hi] { fn(t, lo, hi); });
+    }
+    for (auto& w : workers) w.join();
+}
+
+// atomically lowers target to val, returns true if val was smaller
+template <typename W>
+bool atomicMin(std::atomic<W>& target, W val) {
+    W curr = target.load(std::memory_order_relaxed);
+    while (val < curr) {
+        if (target.compare_exchange_weak(curr, val, std::memory_order_relaxed)) return true;
+    }
+    return false;
+}
+
+/* fixed set of worker threads kept alive across batches
+//   - run(count, fn) hands out indices [0, count) one at a time, so uneven tasks (e.g. one search per source) balance
+//   - calling thread blocks until every index of the batch is done, batches must not be started concurrently
+*/
+class ThreadPool {
+    private:
+        std::vector<std::thread> workers;
+        std::mutex mtx;
+        std::condition_variable start_cv, done_cv;
+        std::function<void(unsigned, std::size_t)> task;
+        std::size_t count = 0;
+        std::atomic<std::size_t> next_index{0};
+        std::size_t generation = 0; // # of batches started, wakes workers
+        unsigned active = 0; // workers still busy with current batch
+        bool stopping = false;
+
+        void work(unsigned id) {
+            std::size_t seen = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mtx);
+                    start_cv.wait(lock, [&] { return stopping || generation != seen; });
+                    if (stopping) return;
+                    seen = generation;
+                }
+                for (std::size_t i; (i = next_index.fetch_add(1, std::memory_order_relaxed)) < count;)
+                    task(id, i);
+                std::lock_guard<std::mutex> lock(mtx);
+                if (--active == 0) done_cv.notify_one();
+            }
+        }
+
+    public:
+        explicit ThreadPool(unsigned threads = defaultThreads()) {
+            for (unsigned t = 0; t < std::max(1u, threads); t++)
+                workers.emplace_back([this, t] { work(t); });
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                stopping = true;
+            }
+            start_cv.notify_all();
+            for (auto& w : workers) w.join();
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        unsigned size() const { return workers.size(); }
+
+        // calls fn(worker id, i) for every i in [0, count), returns once all calls have finished
+        template <typename F>
+        void run(std::size_t p_count, F&& fn) {
+            if (p_count == 0) return;
+            std::unique_lock<std::mutex> lock(mtx);
+            task = [&fn](unsigned t, std::size_t i) { fn(t, i); };
+            count = p_count;
+            next_index.store(0, std::memory_order_relaxed);
+            active = workers.size();
+            generation++;
+            start_cv.notify_all();
+            done_cv.wait(lock, [&] { return active == 0; });
+        }
+};
@@ -0,0 +1,84 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "ParallelBFS.h"
+#include "Generators.h"
+#include "DijkstraEngine.h"
+
+typedef CSRGraph<int, int> graph_t;
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// unit weights, so dijkstra's computes hop distances too
+std::vector<edge> unitWeights(std::vector<edge> edges) {
+    for (auto& e : edges) e.weight = 1;
+    return edges;
+}
+
+// sample test case & gteps of direction optimizing bfs vs dijkstra's with unit weights
+int main() {
+    std::vector<edge> sample = {{0, 1}, {0, 2}, {1, 3}, {2, 3}, {3, 4}, {5, 4}};
+    std::vector<int> depth = parallelBFS(sample, 6, 0);
+    std::cout << std::left << std::setw(10) << "Vertex" << "Hops from 0" << '\n';
+    for (int v = 0; v < 6; v++) std::cout << std::setw(10) << v << depth[v] << '\n';
+
+    const int scale = 20, n = 1 << scale;
+    std::vector<std::pair<std::string, std::vector<edge>>> families;
+    families.push_back({"grid 1024x1024", gridGraph(1024, 42)});
+    families.push_back({"erdos-renyi 1M", erdosRenyiGraph(n, 16ull * n, 42)});
+    families.push_back({"r-mat 2^20", rmatGraph(scale, 16ull * n, 42)});
+    std::cout << '\n' << std::setw(16) << "graph" << std::setw(28) << "method" << std::setw(10) << "threads" << std::setw(12) << "ms"
+              << std::setw(10) << "GTEPS" << std::setw(12) << "td / bu" << "same" << '\n';
+    std::vector<unsigned> thread_counts = {1};
+    if (defaultThreads() > 1) thread_counts.push_back(defaultThreads());
+    for (auto& [name, edges] : families) {
+        graph_t graph(unitWeights(edges), n);
+        std::vector<edge>().swap(edges);
+        std::mt19937 rng(3);
+        std::vector<int> sources;
+        while (sources.size() < 4) {
+            int s = rng() % n;
+            if (graph.degree(s) > 0) sources.push_back(s);
+        }
+        // reference hop distances & graph500 convention: edges of the traversed component
+        DijkstraEngine<graph_t> dijkstra(graph);
+        std::vector<std::vector<int>> expected;
+        double dijkstra_ms = 0, traversed = 0;
+        for (int s : sources) {
+            auto start = std::chrono::steady_clock::now();
+            dijkstra.run(s);
+            dijkstra_ms += elapsed(start);
+            expected.emplace_back(n, -1);
+            for (int v = 0; v < n; v++) {
+                if (!dijkstra.isSettled(v)) continue;
+                expected.back()[v] = dijkstra.distance(v);
+                traversed += graph.degree(v);
+            }
+        }
+        auto report = [&](const std::string& method, unsigned threads, double ms, const std::string& steps, bool same) {
+            std::cout << std::setw(16) << name << std::setw(28) << method << std::setw(10) << threads << std::setw(12) << ms / sources.size()
+                      << std::setw(10) << traversed / ms / 1e6 << std::setw(12) << steps << (same ? "yes" : "no") << '\n';
+        };
+        report("dijkstra's, unit weights", 1, dijkstra_ms, "-", true);
+        for (unsigned threads : thread_counts) {
+            ParallelBFS<graph_t> bfs(graph, threads);
+            for (double alpha : {0.0, 15.0}) {
+                double ms = 0;
+                std::size_t td = 0, bu = 0;
+                bool same = true;
+                for (std::size_t i = 0; i < sources.size(); i++) {
+                    auto start = std::chrono::steady_clock::now();
+                    bfs.run(sources[i], alpha);
+                    ms += elapsed(start);
+                    td += bfs.topDownSteps();
+                    bu += bfs.bottomUpSteps();
+                    same = same && bfs.depthArray() == expected[i];
+                }
+                report(alpha < 1 ? "bfs, top-down only" : "bfs, direction optimizing", threads, ms, std::to_string(td) + " / " + std::to_string(bu), same);
+            }
+        }
+    }
+    return 0;
+}
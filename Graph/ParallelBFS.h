@@ -0,0 +1,148 @@
+#pragma once
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include "Graph.h"
+
+/* direction optimizing parallel breadth first search (beamer et al.) - hop distances for unweighted / unit weight queries
+//   - top-down step: threads split the frontier queue & claim unvisited out-neighbors with a compare & swap on parent
+//   - bottom-up step: threads split the unvisited vertices, each scans its in-neighbors until one lies in the frontier;
+//     frontier is a bitmap, every vertex has one owner so no atomics are needed & the scan stops at the first hit
+//   - switches to bottom-up when edges out of the frontier exceed edges out of unvisited vertices / alpha, & back
+//     to top-down once the frontier shrinks below |V| / beta
+// note: bottom-up steps need in-edges, so the reverse graph is built once by the constructor
+// @template
+//   - G: graph type providing vertexCount(), neighbors(v), degree(v) & transpose() (e.g. CSRGraph)
+*/
+template <typename G>
+class ParallelBFS {
+    public:
+        typedef typename G::vertex_type V;
+
+    private:
+        const G* graph;
+        G reverse;
+        std::size_t n;
+        unsigned threads;
+        std::vector<std::atomic<V>> parents; // -1 if unreached
+        std::vector<int> depths; // -1 if unreached
+        std::vector<std::uint64_t> front, next; // frontier bitmaps for bottom-up steps
+        std::size_t top_down_steps = 0, bottom_up_steps = 0;
+
+        bool inFront(V v) const { return front[v >> 6] >> (v & 63) & 1; }
+
+        // expands frontier queue, returns next queue
+        std::vector<V> topDown(const std::vector<V>& frontier, int depth, std::vector<std::vector<V>>& local) {
+            parallelFor(0, frontier.size(), [&](unsigned t, std::size_t lo, std::size_t hi) {
+                for (std::size_t i = lo; i < hi; i++) {
+                    V u = frontier[i];
+                    for (auto [v, weight] : graph->neighbors(u)) {
+                        V expected = -1;
+                        if (parents[v].load(std::memory_order_relaxed) != -1) continue;
+                        if (!parents[v].compare_exchange_strong(expected, u, std::memory_order_relaxed)) continue;
+                        depths[v] = depth;
+                        local[t].push_back(v);
+                    }
+                }
+            }, threads, 64);
+            std::vector<V> result;
+            for (auto& l : local) {
+                result.insert(result.end(), l.begin(), l.end());
+                l.clear();
+            }
+            return result;
+        }
+
+        // fills next bitmap from front bitmap, returns # of vertices added
+        std::size_t bottomUp(int depth) {
+            std::size_t words = front.size();
+            std::vector<std::size_t> counts(threads, 0);
+            parallelFor(0, words, [&](unsigned t, std::size_t lo, std::size_t hi) {
+                for (std::size_t w = lo; w < hi; w++) {
+                    std::uint64_t bits = 0;
+                    for (std::size_t v = w * 64; v < std::min(n, w * 64 + 64); v++) {
+                        if (parents[v].load(std::memory_order_relaxed) != -1) continue;
+                        for (auto [u, weight] : reverse.neighbors(v)) {
+                            if (!inFront(u)) continue;
+                            parents[v].store(u, std::memory_order_relaxed);
+                            depths[v] = depth;
+                            bits |= std::uint64_t(1) << (v & 63);
+                            counts[t]++;
+                            break;
+                        }
+                    }
+                    next[w] = bits;
+                }
+            }, threads, 256);
+            front.swap(next);
+            std::size_t added = 0;
+            for (std::size_t c : counts) added += c;
+            return added;
+        }
+
+    public:
+        ParallelBFS(const G& p_graph, unsigned p_threads = defaultThreads())
+            : graph(&p_graph), reverse(p_graph.transpose(p_threads)), n(p_graph.vertexCount()), threads(p_threads), parents(n), depths(n),
+              front((n + 63) / 64), next((n + 63) / 64) {}
+
+        /* hop distances from src
+        // @params
+        //   - alpha: top-down -> bottom-up switch ratio (0 = top-down only), beta: bottom-up -> top-down switch ratio
+        */
+        void run(V src, double alpha = 15, double beta = 18) {
+            parallelFor(0, n, [&](unsigned, std::size_t lo, std::size_t hi) {
+                for (std::size_t v = lo; v < hi; v++) {
+                    parents[v].store(-1, std::memory_order_relaxed);
+                    depths[v] = -1;
+                }
+            }, threads);
+            top_down_steps = bottom_up_steps = 0;
+            parents[src].store(src, std::memory_order_relaxed);
+            depths[src] = 0;
+            std::vector<std::vector<V>> local(threads);
+            std::vector<V> frontier = {src};
+            std::size_t unexplored = graph->edgeCount() - graph->degree(src); // edges out of unvisited vertices
+            for (int depth = 1; !frontier.empty(); depth++) {
+                std::size_t scout = 0; // edges out of frontier
+                for (V v : frontier) scout += graph->degree(v);
+                if (alpha > 0 && (double) scout > unexplored / alpha) {
+                    // queue -> bitmap, bottom-up steps while frontier is large or growing
+                    std::fill(front.begin(), front.end(), 0);
+                    for (V v : frontier) front[v >> 6] |= std::uint64_t(1) << (v & 63);
+                    std::size_t size = frontier.size(), prev;
+                    do {
+                        prev = size;
+                        size = bottomUp(depth++);
+                        bottom_up_steps++;
+                    } while (size > 0 && (size >= prev || (double) size > n / beta));
+                    depth--;
+                    // bitmap -> queue
+                    frontier.clear();
+                    for (std::size_t w = 0; w < front.size(); w++)
+                        for (std::uint64_t bits = front[w]; bits; bits &= bits - 1)
+                            frontier.push_back((V) (w * 64 + __builtin_ctzll(bits)));
+                    for (V v : frontier) unexplored -= std::min(unexplored, graph->degree(v));
+                    continue;
+                }
+                frontier = topDown(frontier, depth, local);
+                top_down_steps++;
+                for (V v : frontier) unexplored -= std::min(unexplored, graph->degree(v));
+            }
+        }
+
+        // # of edges from src to v (-1 if unreachable)
+        int depth(V v) const { return depths[v]; }
+        // bfs tree parent of v (src for src itself, -1 if unreachable)
+        V parent(V v) const { return parents[v].load(std::memory_order_relaxed); }
+        const std::vector<int>& depthArray() const { return depths; }
+        std::size_t topDownSteps() const { return top_down_steps; }
+        std::size_t bottomUpSteps() const { return bottom_up_steps; }
+};
+
+// hop distances directly from edge set (same input as dijkstra's & bellman ford samples, weights ignored)
+inline std::vector<int> parallelBFS(const std::vector<edge>& edges, int n, int src, unsigned threads = defaultThreads()) {
+    CSRGraph<int, double> graph(edges, n, threads);
+    ParallelBFS<CSRGraph<int, double>> bfs(graph, threads);
+    bfs.run(src);
+    return bfs.depthArray();
+}
@@ -0,0 +1,133 @@
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "PathCache.h"
+
+typedef CSRGraph<int, double> graph_t;
+typedef ShortestPathCache<graph_t> cache_t;
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// zipf distributed ranks in [0, k): rank r is drawn with probability proportional to 1 / (r + 1)^s
+class ZipfSampler {
+    private:
+        std::vector<double> cumulative;
+    public:
+        ZipfSampler(int k, double s) : cumulative(k) {
+            double total = 0;
+            for (int r = 0; r < k; r++) cumulative[r] = total += 1 / std::pow(r + 1, s);
+            for (double& c : cumulative) c /= total;
+        }
+        template <typename R>
+        int operator()(R& rng) {
+            double u = std::uniform_real_distribution<double>(0, 1)(rng);
+            return std::min<int>(cumulative.size() - 1, std::lower_bound(cumulative.begin(), cumulative.end(), u) - cumulative.begin());
+        }
+};
+
+// sample test case, then hit rate & latency of LRU / LFU caches (one lookup per query) vs one dijkstra's per query on a
+// zipf skewed query stream
+int main() {
+    std::vector<edge> sample = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, 5}, {0, 4, 5}};
+    std::cout << std::left;
+    graph_t small(sample, 5);
+    cache_t sample_cache(small, 2 * cache_t::treeBytes(5));
+    int buffer[5];
+    for (int src : {1, 0, 1, 2, 1}) {
+        std::size_t length = sample_cache.path(src, 4, buffer, 5);
+        std::cout << "Vertex " << src << " to 4 (dist " << sample_cache.distance(src, 4) << "): ";
+        if (length == 0) std::cout << "unreachable";
+        for (std::size_t i = 0; i < length; i++) std::cout << (i ? " -> " : "") << buffer[i];
+        std::cout << '\n';
+    }
+    std::cout << "reverse view 1 to 4:";
+    for (int v : sample_cache.pathView(1, 4)) std::cout << ' ' << v;
+    std::cout << "\nhits " << sample_cache.hitCount() << ", misses " << sample_cache.missCount() << ", evictions "
+              << sample_cache.evictionCount() << ", trees " << sample_cache.size() << " / " << sample_cache.capacity() << '\n';
+
+    const int n = 1 << 14, sources = 1024, queries = 5000;
+    graph_t graph(geometricGraph(n, 4, 42), n);
+    std::mt19937_64 rng(7);
+    std::vector<int> hot(sources);
+    for (int& s : hot) s = rng() % n;
+    ZipfSampler zipf(sources, 1.2);
+    std::vector<std::pair<int, int>> stream(queries);
+    for (auto& [src, dest] : stream) { src = hot[zipf(rng)]; dest = rng() % n; }
+
+    // baseline: early exit dijkstra's & a fresh (reversed) path vector per query
+    DijkstraEngine<graph_t> engine(graph);
+    std::vector<double> expected(queries);
+    std::size_t total_length = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) {
+        expected[q] = engine.runTo(stream[q].first, stream[q].second);
+        total_length += engine.path(stream[q].second).size();
+    }
+    double base_ms = elapsed(start);
+    std::cout << '\n' << std::setw(22) << "method" << std::setw(10) << "trees" << std::setw(12) << "ms" << std::setw(12) << "us/query"
+              << std::setw(10) << "hit rate" << std::setw(12) << "evictions" << std::setw(12) << "memory MB" << "same" << '\n';
+    std::cout << std::setw(22) << "dijkstra per query" << std::setw(10) << 0 << std::setw(12) << base_ms << std::setw(12)
+              << base_ms * 1e3 / queries << std::setw(10) << 0 << std::setw(12) << 0 << std::setw(12) << 0 << "yes" << '\n';
+
+    std::size_t tree_bytes = cache_t::treeBytes(n);
+    for (std::size_t trees : {16, 128}) {
+        for (EvictionPolicy policy : {LRU_EVICTION, LFU_EVICTION}) {
+            cache_t cache(graph, trees * tree_bytes, policy);
+            std::size_t length = 0;
+            bool same = true;
+            start = std::chrono::steady_clock::now();
+            for (int q = 0; q < queries; q++) {
+                auto view = cache.pathView(stream[q].first, stream[q].second);
+                same &= view.distance() == expected[q];
+                length += view.size();
+            }
+            double ms = elapsed(start);
+            std::cout << std::setw(22) << (policy == LRU_EVICTION ? "lru cache" : "lfu cache") << std::setw(10) << trees << std::setw(12) << ms
+                      << std::setw(12) << ms * 1e3 / queries << std::setw(10) << cache.hitRate() << std::setw(12) << cache.evictionCount()
+                      << std::setw(12) << cache.memoryBytes() / 1048576.0 << (same && length == total_length ? "yes" : "no") << '\n';
+        }
+    }
+
+    // path reconstruction alone on a warm cache: fresh reversed vector vs caller buffer vs reused vector vs lazy view
+    cache_t cache(graph, 64 * tree_bytes);
+    std::vector<std::pair<int, int>> warm(100000);
+    for (auto& [src, dest] : warm) { src = hot[rng() % 64]; dest = rng() % n; }
+    for (int s = 0; s < 64; s++) cache.tree(hot[s]);
+    std::size_t check[4] = {0, 0, 0, 0};
+    double ms[4];
+    start = std::chrono::steady_clock::now();
+    for (auto [src, dest] : warm) {
+        auto tree = cache.tree(src);
+        std::vector<int> path;
+        for (int v = dest; v != -1 && tree->dist[dest] != cache_t::INF; v = tree->bp[v]) path.push_back(v);
+        std::reverse(path.begin(), path.end());
+        check[0] += path.size();
+    }
+    ms[0] = elapsed(start);
+    std::vector<int> buf(n);
+    start = std::chrono::steady_clock::now();
+    for (auto [src, dest] : warm) check[1] += cache.path(src, dest, buf.data(), buf.size());
+    ms[1] = elapsed(start);
+    std::vector<int> path;
+    start = std::chrono::steady_clock::now();
+    for (auto [src, dest] : warm) {
+        cache.path(src, dest, path);
+        check[2] += path.size();
+    }
+    ms[2] = elapsed(start);
+    start = std::chrono::steady_clock::now();
+    for (auto [src, dest] : warm) for (int v : cache.pathView(src, dest)) check[3] += v >= 0;
+    ms[3] = elapsed(start);
+    std::cout << '\n' << std::setw(22) << "path api" << std::setw(12) << "ms" << std::setw(12) << "ns/path" << "same" << '\n';
+    const char* names[4] = {"new reversed vector", "caller buffer", "reused vector", "lazy view"};
+    for (int i = 0; i < 4; i++)
+        std::cout << std::setw(22) << names[i] << std::setw(12) << ms[i] << std::setw(12) << ms[i] * 1e6 / warm.size()
+                  << (check[i] == check[0] ? "yes" : "no") << '\n';
+    std::cout << "warm hit rate " << cache.hitRate() << ", memory " << cache.memoryBytes() / 1048576.0 << " / "
+              << cache.budgetBytes() / 1048576.0 << " MB" << '\n';
+    return 0;
+}
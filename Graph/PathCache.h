@@ -0,0 +1,213 @@
+#pragma once
+#include <set>
+#include <memory>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include "DijkstraEngine.h"
+
+enum EvictionPolicy { LRU_EVICTION, LFU_EVICTION };
+
+/* bounded cache of shortest path trees (dist & bp arrays per source) for repeated queries from hot sources
+//   - a miss runs one full dijkstra's (DijkstraEngine) & copies its tree, a hit answers distance & path queries directly
+//   - memory is accounted per tree (both arrays + bookkeeping), trees are evicted once the byte budget would be exceeded
+//   - LRU_EVICTION evicts least recently used source, LFU_EVICTION least frequently used (ties: least recently used)
+//   - evicted trees are recycled for the next miss, so a warm cache stops allocating
+//   - paths are written into a caller buffer from the back (no reversing) or walked lazily through a PathView
+// note: not thread-safe (one cache per thread, like DijkstraEngine), LFU counts never decay, so sources that were hot
+//       long ago stay cached until hotter ones overtake them
+// @template
+//   - G: graph type providing vertexCount() & neighbors(v) (e.g. CSRGraph)
+//   - Q: priority queue policy from PriorityQueues.h used by the engine
+*/
+template <typename G, template <typename, typename> class Q = LazyHeap>
+class ShortestPathCache {
+    public:
+        typedef typename G::vertex_type V;
+        typedef typename G::weight_type W;
+
+        static constexpr W INF = std::numeric_limits<W>::max();
+
+        // shortest path tree of one source (INF distance & -1 back pointer for unreachable vertices, -1 for src)
+        struct Tree {
+            V src;
+            std::vector<W> dist;
+            std::vector<V> bp;
+        };
+
+        /* lazy path view - walks back pointers from dest to src without copying the path (so in reverse order)
+        //   - shares ownership of its tree, so it stays valid after the tree is evicted
+        */
+        class PathView {
+            private:
+                std::shared_ptr<const Tree> tree;
+                V dest;
+
+            public:
+                class iterator {
+                    private:
+                        const V* bp;
+                        V v;
+
+                    public:
+                        typedef std::forward_iterator_tag iterator_category;
+                        typedef V value_type;
+                        typedef std::ptrdiff_t difference_type;
+                        typedef const V* pointer;
+                        typedef const V& reference;
+
+                        iterator(const V* p_bp, V p_v) : bp(p_bp), v(p_v) {}
+                        const V& operator*() const { return v; }
+                        iterator& operator++() { v = bp[v]; return *this; }
+                        iterator operator++(int) { iterator prev = *this; v = bp[v]; return prev; }
+                        bool operator==(const iterator& other) const { return v == other.v; }
+                        bool operator!=(const iterator& other) const { return v != other.v; }
+                };
+
+                PathView(std::shared_ptr<const Tree> p_tree, V p_dest) : tree(std::move(p_tree)), dest(p_dest) {}
+
+                iterator begin() const { return iterator(tree->bp.data(), empty() ? -1 : dest); }
+                iterator end() const { return iterator(tree->bp.data(), -1); }
+                bool empty() const { return tree->dist[dest] == INF; }
+                // # of vertices on path, O(path length)
+                std::size_t size() const { return std::distance(begin(), end()); }
+                W distance() const { return tree->dist[dest]; }
+                V source() const { return tree->src; }
+        };
+
+    private:
+        typedef std::pair<std::uint64_t, std::uint64_t> priority; // {use count (LFU only), last use}, smallest evicted first
+
+        struct Entry {
+            std::shared_ptr<Tree> tree;
+            priority key;
+        };
+
+        // estimate of hash map node, ordered set node & shared_ptr control block per tree
+        static constexpr std::size_t ENTRY_BYTES = sizeof(Entry) + sizeof(Tree) + sizeof(std::pair<priority, V>) + 8 * sizeof(void*);
+
+        DijkstraEngine<G, Q> engine;
+        std::size_t n;
+        EvictionPolicy policy;
+        std::size_t max_bytes, tree_bytes;
+        std::unordered_map<V, Entry> entries;
+        std::set<std::pair<priority, V>> order; // eviction order
+        std::uint64_t tick = 0, hits = 0, misses = 0, evictions = 0;
+
+        // # of vertices on path src -> dest of tree t (0 if unreachable)
+        static std::size_t pathLength(const Tree& t, V dest) {
+            if (t.dist[dest] == INF) return 0;
+            std::size_t length = 1;
+            for (V v = dest; t.bp[v] != -1; v = t.bp[v]) length++;
+            return length;
+        }
+
+        // writes path of given length from the back, so the chain is never reversed
+        static void fillPath(const Tree& t, V dest, V* buffer, std::size_t length) {
+            for (V v = dest; length > 0; v = t.bp[v]) buffer[--length] = v;
+        }
+
+        void touch(V src, Entry& entry) {
+            order.erase({entry.key, src});
+            entry.key = {policy == LFU_EVICTION ? entry.key.first + 1 : 0, ++tick};
+            order.insert({entry.key, src});
+        }
+
+        // removes first tree in eviction order & returns it for reuse
+        std::shared_ptr<Tree> evict() {
+            V victim = order.begin()->second;
+            order.erase(order.begin());
+            auto it = entries.find(victim);
+            std::shared_ptr<Tree> tree = std::move(it->second.tree);
+            entries.erase(it);
+            evictions++;
+            return tree;
+        }
+
+        const std::shared_ptr<Tree>& lookup(V src) {
+            auto it = entries.find(src);
+            if (it != entries.end()) {
+                hits++;
+                touch(src, it->second);
+                return it->second.tree;
+            }
+            misses++;
+            std::shared_ptr<Tree> tree;
+            if ((entries.size() + 1) * tree_bytes > max_bytes) tree = evict();
+            // an evicted tree still held by a PathView must not be overwritten
+            if (!tree || tree.use_count() > 1) tree = std::make_shared<Tree>();
+            engine.run(src);
+            tree->src = src;
+            tree->dist.resize(n);
+            tree->bp.resize(n);
+            for (std::size_t v = 0; v < n; v++) {
+                tree->dist[v] = engine.distance(v);
+                tree->bp[v] = engine.parent(v);
+            }
+            Entry& entry = entries[src];
+            entry.tree = std::move(tree);
+            entry.key = {policy == LFU_EVICTION ? 1 : 0, ++tick};
+            order.insert({entry.key, src});
+            return entry.tree;
+        }
+
+    public:
+        // throws std::invalid_argument if max_bytes can't hold a single tree
+        ShortestPathCache(const G& graph, std::size_t p_max_bytes, EvictionPolicy p_policy = LRU_EVICTION)
+            : engine(graph), n(graph.vertexCount()), policy(p_policy), max_bytes(p_max_bytes),
+              tree_bytes(treeBytes(graph.vertexCount())) {
+            if (max_bytes < tree_bytes) throw std::invalid_argument("cache budget is smaller than one shortest path tree");
+        }
+
+        // tree of src (computed on a miss), shared so it outlives its eviction
+        std::shared_ptr<const Tree> tree(V src) { return lookup(src); }
+
+        W distance(V src, V dest) { return lookup(src)->dist[dest]; }
+
+        /* writes path src -> dest into buffer & returns its # of vertices (0 if dest is unreachable)
+        //   - if the path has more than capacity vertices, nothing is written & the required capacity is returned
+        */
+        std::size_t path(V src, V dest, V* buffer, std::size_t capacity) {
+            const Tree& t = *lookup(src);
+            std::size_t length = pathLength(t, dest);
+            if (length <= capacity) fillPath(t, dest, buffer, length);
+            return length;
+        }
+
+        // path src -> dest into out (empty if unreachable), reuses out's storage across calls
+        void path(V src, V dest, std::vector<V>& out) {
+            const Tree& t = *lookup(src);
+            out.resize(pathLength(t, dest));
+            fillPath(t, dest, out.data(), out.size());
+        }
+
+        PathView pathView(V src, V dest) { return PathView(lookup(src), dest); }
+
+        // true if src's tree is cached (does not count as a use)
+        bool contains(V src) const { return entries.count(src) > 0; }
+
+        void clear() {
+            entries.clear();
+            order.clear();
+        }
+
+        void resetStats() { hits = misses = evictions = 0; }
+
+        std::size_t size() const { return entries.size(); }
+        // max # of trees that fit in the budget
+        std::size_t capacity() const { return max_bytes / tree_bytes; }
+        std::size_t hitCount() const { return hits; }
+        std::size_t missCount() const { return misses; }
+        std::size_t evictionCount() const { return evictions; }
+        double hitRate() const { return hits + misses ? (double) hits / (hits + misses) : 0; }
+        // accounted bytes of cached trees, never above budgetBytes()
+        std::size_t memoryBytes() const { return entries.size() * tree_bytes; }
+        std::size_t budgetBytes() const { return max_bytes; }
+        std::size_t treeBytes() const { return tree_bytes; }
+        // accounted bytes of one tree over a graph of given # of vertices (for sizing budgets)
+        static std::size_t treeBytes(std::size_t vertices) { return vertices * (sizeof(W) + sizeof(V)) + ENTRY_BYTES; }
+};
@@ -0,0 +1,61 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Generators.h"
+#include "DijkstraEngine.h"
+
+typedef CSRGraph<int, long long> graph_t;
+
+// runs full queries from fixed sources, returns ms per query & accumulates distance checksum
+template <template <typename, typename> class Q>
+double timeQueue(const graph_t& graph, const std::vector<int>& sources, long long& checksum) {
+    DijkstraEngine<graph_t, Q> engine(graph);
+    checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int src : sources) {
+        engine.run(src);
+        for (std::size_t v = 0; v < graph.vertexCount(); v++)
+            if (engine.isSettled(v)) checksum += engine.distance(v);
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / sources.size();
+}
+
+// benchmark matrix of priority queue policy x graph family (ms per full single source query)
+int main() {
+    const int queries = 10;
+    std::vector<std::pair<std::string, graph_t>> families;
+    families.push_back({"grid 400x400", graph_t(gridGraph(400, 42), 400 * 400)});
+    families.push_back({"geometric 200K", graph_t(geometricGraph(200000, 4, 42, 1000), 200000)});
+    families.push_back({"erdos-renyi 200K", graph_t(erdosRenyiGraph(200000, 1600000, 42), 200000)});
+    families.push_back({"r-mat 2^18", graph_t(rmatGraph(18, 2000000, 42), 1 << 18)});
+
+    std::string names[] = {"lazy (std heap)", "lazy (BinaryHeap)", "4-ary decrease-key", "fibonacci", "radix", "dial buckets"};
+    std::cout << std::left << std::setw(20) << "queue";
+    for (const auto& f : families) std::cout << std::setw(20) << f.first;
+    std::cout << '\n';
+    std::vector<std::vector<double>> ms(6);
+    std::vector<bool> consistent(families.size(), true);
+    for (std::size_t f = 0; f < families.size(); f++) {
+        const graph_t& graph = families[f].second;
+        std::mt19937 rng(7);
+        std::vector<int> sources(queries);
+        for (auto& s : sources) s = rng() % graph.vertexCount();
+        long long sums[6];
+        ms[0].push_back(timeQueue<LazyHeap>(graph, sources, sums[0]));
+        ms[1].push_back(timeQueue<LazyBinaryHeap>(graph, sources, sums[1]));
+        ms[2].push_back(timeQueue<QuaternaryHeap>(graph, sources, sums[2]));
+        ms[3].push_back(timeQueue<FibonacciQueue>(graph, sources, sums[3]));
+        ms[4].push_back(timeQueue<RadixQueue>(graph, sources, sums[4]));
+        ms[5].push_back(timeQueue<DialQueue>(graph, sources, sums[5]));
+        for (int q = 1; q < 6; q++) if (sums[q] != sums[0]) consistent[f] = false;
+    }
+    for (int q = 0; q < 6; q++) {
+        std::cout << std::setw(20) << names[q];
+        for (double x : ms[q]) std::cout << std::setw(20) << x;
+        std::cout << '\n';
+    }
+    std::cout << std::setw(20) << "same distances";
+    for (bool c : consistent) std::cout << std::setw(20) << (c ? "yes" : "no");
+    std::cout << '\n';
+    return 0;
+}
@@ -0,0 +1,276 @@
+#pragma once
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include "../Heap/BinaryHeap.h"
+#include "../Heap/FibonacciHeap.h"
+#include "../Heap/RadixHeap.h"
+#include "../Heap/BucketQueue.h"
+
+/* priority queue policies for DijkstraEngine - every policy Q<V, W> provides:
+//   - Q(const G& graph): sized for graph's vertices (& max weight, for bucket queues)
+//   - push(v, d): queues v with key d, or lowers its key if v is still queued (d is never larger than v's last key)
+//   - pop(): removes & returns an entry {d, v} with minimum key; lazy policies keep duplicates of a vertex & may
+//     return stale entries, which the engine skips (d != dist[v] or v already settled)
+//   - empty(), clear()
+// lazy: LazyHeap (std::push_heap on a vector), LazyBinaryHeap (Heap/BinaryHeap), RadixQueue & DialQueue (integer keys)
+// addressable (one entry per vertex, decrease-key in place): QuaternaryHeap, FibonacciQueue (Heap/FibonacciHeap)
+*/
+
+// lazy-insert binary heap over std::push_heap / std::pop_heap
+template <typename V, typename W>
+class LazyHeap {
+    private:
+        typedef std::pair<W, V> entry;
+        std::vector<entry> heap;
+
+    public:
+        template <typename G>
+        LazyHeap(const G&) {}
+
+        bool empty() const { return heap.empty(); }
+        void clear() { heap.clear(); }
+
+        void push(V v, W d) {
+            heap.push_back({d, v});
+            std::push_heap(heap.begin(), heap.end(), std::greater<entry>());
+        }
+
+        entry pop() {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<entry>());
+            entry top = heap.back();
+            heap.pop_back();
+            return top;
+        }
+};
+
+// lazy-insert binary heap using the repo's BinaryHeap
+template <typename V, typename W>
+class LazyBinaryHeap {
+    private:
+        typedef std::pair<W, V> entry;
+        BinaryHeap<entry, std::greater<entry>> heap;
+
+    public:
+        template <typename G>
+        LazyBinaryHeap(const G&) {}
+
+        bool empty() const { return heap.empty(); }
+        void clear() { heap.clear(); }
+        void push(V v, W d) { heap.push({d, v}); }
+
+        entry pop() {
+            entry top = heap.top();
+            heap.pop();
+            return top;
+        }
+};
+
+// addressable 4-ary heap - each vertex is queued at most once, its position is tracked for in-place decrease-key
+template <typename V, typename W>
+class QuaternaryHeap {
+    private:
+        typedef std::pair<W, V> entry;
+        static constexpr std::size_t ARITY = 4, NONE = std::numeric_limits<std::size_t>::max();
+
+        std::vector<entry> heap;
+        std::vector<std::size_t> pos; // index of vertex in heap (NONE if not queued)
+
+        void place(std::size_t i, const entry& e) {
+            heap[i] = e;
+            pos[e.second] = i;
+        }
+
+        void siftUp(std::size_t i) {
+            entry e = heap[i];
+            while (i > 0) {
+                std::size_t p = (i - 1) / ARITY;
+                if (heap[p].first <= e.first) break;
+                place(i, heap[p]);
+                i = p;
+            }
+            place(i, e);
+        }
+
+        void siftDown(std::size_t i) {
+            entry e = heap[i];
+            while (true) {
+                std::size_t first = i * ARITY + 1, best = i;
+                if (first >= heap.size()) break;
+                W best_key = e.first;
+                for (std::size_t c = first; c < std::min(first + ARITY, heap.size()); c++) {
+                    if (heap[c].first < best_key) {
+                        best = c;
+                        best_key = heap[c].first;
+                    }
+                }
+                if (best == i) break;
+                place(i, heap[best]);
+                i = best;
+            }
+            place(i, e);
+        }
+
+    public:
+        template <typename G>
+        QuaternaryHeap(const G& graph) : pos(graph.vertexCount(), NONE) {}
+
+        bool empty() const { return heap.empty(); }
+
+        void clear() {
+            for (const auto& e : heap) pos[e.second] = NONE;
+            heap.clear();
+        }
+
+        void push(V v, W d) {
+            if (pos[v] == NONE) {
+                heap.push_back({d, v});
+                pos[v] = heap.size() - 1;
+            } else
+                heap[pos[v]].first = d;
+            siftUp(pos[v]);
+        }
+
+        entry pop() {
+            entry top = heap[0];
+            pos[top.second] = NONE;
+            if (heap.size() > 1) {
+                heap[0] = heap.back();
+                heap.pop_back();
+                siftDown(0);
+            } else
+                heap.pop_back();
+            return top;
+        }
+};
+
+// addressable fibonacci heap - O(1) amortized decrease-key through node handles kept per vertex
+template <typename V, typename W>
+class FibonacciQueue {
+    private:
+        typedef std::pair<W, V> entry;
+        typedef typename FibonacciHeap<entry>::handle handle;
+
+        FibonacciHeap<entry> heap;
+        std::vector<handle> nodes; // node of queued vertex (nullptr if not queued)
+        std::vector<V> queued; // vertices pushed since last clear
+
+    public:
+        template <typename G>
+        FibonacciQueue(const G& graph) : nodes(graph.vertexCount(), nullptr) {}
+
+        bool empty() const { return heap.empty(); }
+
+        void clear() {
+            for (V v : queued) nodes[v] = nullptr;
+            queued.clear();
+            heap.clear();
+        }
+
+        void push(V v, W d) {
+            if (nodes[v])
+                heap.decrease(nodes[v], {d, v});
+            else {
+                nodes[v] = heap.push({d, v});
+                queued.push_back(v);
+            }
+        }
+
+        entry pop() {
+            entry top = heap.top();
+            heap.pop();
+            nodes[top.second] = nullptr;
+            return top;
+        }
+};
+
+// lazy radix heap - monotone integer keys, O(log C) amortized per operation
+template <typename V, typename W>
+class RadixQueue {
+    static_assert(std::is_integral<W>::value, "radix heap requires integer weights");
+
+    private:
+        RadixHeap<V, std::uint64_t> heap;
+
+    public:
+        template <typename G>
+        RadixQueue(const G&) {}
+
+        bool empty() const { return heap.empty(); }
+        void clear() { heap.clear(); }
+        void push(V v, W d) { heap.push({(std::uint64_t) d, v}); }
+
+        std::pair<W, V> pop() {
+            auto top = heap.top();
+            heap.pop();
+            return {(W) top.first, top.second};
+        }
+};
+
+// lazy bucket queue (dial's algorithm) - monotone integer keys within max edge weight of the current minimum
+template <typename V, typename W>
+class DialQueue {
+    static_assert(std::is_integral<W>::value, "bucket queue requires integer weights");
+
+    private:
+        BucketQueue<V, std::uint64_t> queue;
+
+        template <typename G>
+        static std::uint64_t maxWeight(const G& graph) {
+            W mx = 0;
+            for (std::size_t v = 0; v < graph.vertexCount(); v++)
+                for (auto [next, weight] : graph.neighbors(v)) mx = std::max(mx, weight);
+            return mx;
+        }
+
+    public:
+        template <typename G>
+        DialQueue(const G& graph) : queue(maxWeight(graph)) {}
+
+        bool empty() const { return queue.empty(); }
+        void clear() { queue.clear(); }
+        void push(V v, W d) { queue.push({(std::uint64_t) d, v}); }
+
+        std::pair<W, V> pop() {
+            auto top = queue.top();
+            queue.pop();
+            return {(W) top.first, top.second};
+        }
+};
+
+/* compile time check of the policy interface above - DijkstraEngine static_asserts each trait, so a policy that
+// doesn't conform fails with one message naming the missing operation instead of errors deep inside the engine
+// (top() isn't part of the interface: pop() returns the minimum entry)
+*/
+namespace detail {
+    template <typename Q, typename G, typename = void>
+    struct QueueConstructible : std::false_type {};
+    template <typename Q, typename G>
+    struct QueueConstructible<Q, G, std::void_t<decltype(Q(std::declval<const G&>()))>> : std::true_type {};
+
+    template <typename Q, typename V, typename W, typename = void>
+    struct QueuePush : std::false_type {};
+    template <typename Q, typename V, typename W>
+    struct QueuePush<Q, V, W, std::void_t<decltype(std::declval<Q&>().push(std::declval<V>(), std::declval<W>()))>> : std::true_type {};
+
+    template <typename Q, typename V, typename W, typename = void>
+    struct QueuePop : std::false_type {};
+    template <typename Q, typename V, typename W>
+    struct QueuePop<Q, V, W, std::void_t<decltype(std::declval<Q&>().pop())>>
+        : std::is_convertible<decltype(std::declval<Q&>().pop()), std::pair<W, V>> {};
+
+    template <typename Q, typename = void>
+    struct QueueEmpty : std::false_type {};
+    template <typename Q>
+    struct QueueEmpty<Q, std::void_t<decltype(std::declval<const Q&>().empty())>>
+        : std::is_convertible<decltype(std::declval<const Q&>().empty()), bool> {};
+
+    template <typename Q, typename = void>
+    struct QueueClear : std::false_type {};
+    template <typename Q>
+    struct QueueClear<Q, std::void_t<decltype(std::declval<Q&>().clear())>> : std::true_type {};
+}
@@ -0,0 +1,109 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include "Reorder.h"
+#include "Generators.h"
+#include "DijkstraEngine.h"
+#include "BellmanFordEngine.h"
+#include "BlockedFloydWarshall.h"
+
+typedef CSRGraph<int, long long> graph_t;
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// mean |perm[u] - perm[v]| over all edges - small gaps mean neighbors share cache lines
+double meanGap(const graph_t& graph) {
+    double total = 0;
+    for (std::size_t u = 0; u < graph.vertexCount(); u++)
+        for (auto [v, weight] : graph.neighbors(u)) total += std::abs((double) v - (double) u);
+    return total / graph.edgeCount();
+}
+
+// scatters vertex ids like ids coming from an external system
+std::vector<edge> scramble(std::vector<edge> edges, int n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<int> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), rng);
+    return relabel(std::move(edges), perm);
+}
+
+// sample test case & benchmark of sssp, bellman ford & floyd warshall on scrambled vs reordered ids
+int main() {
+    std::vector<edge> sample = {{0, 5, 1}, {5, 2, 1}, {2, 7, 1}, {7, 1, 1}, {1, 6, 1}, {6, 3, 1}, {3, 4, 1}, {4, 0, 1}, {0, 3, 1}};
+    graph_t small(sample, 8);
+    std::string names[] = {"bfs", "rcm", "degree"};
+    for (Ordering o : {BFS_ORDER, RCM_ORDER, DEGREE_ORDER}) {
+        std::vector<int> perm = vertexOrder(small, o);
+        std::cout << std::left << std::setw(8) << names[o] << "old -> new:";
+        for (int v = 0; v < 8; v++) std::cout << ' ' << v << "->" << perm[v];
+        std::cout << "  (mean gap " << meanGap(small) << " -> " << meanGap(relabel(small, perm)) << ")\n";
+    }
+
+    const int scale = 20, n = 1 << scale, side = 1 << (scale / 2);
+    std::vector<std::pair<std::string, std::vector<edge>>> families;
+    families.push_back({"grid 1024x1024", scramble(gridGraph(side, 42), n, 7)});
+    families.push_back({"geometric 1M", geometricGraph(n, 4, 42, 1000)});
+    families.push_back({"r-mat 2^20", rmatGraph(scale, 8ull * n, 42)});
+    std::cout << '\n' << std::setw(16) << "graph" << std::setw(10) << "order" << std::setw(12) << "mean gap" << std::setw(14) << "order (ms)"
+              << std::setw(16) << "dijkstra (ms)" << std::setw(18) << "bellman ford (ms)" << "same distances" << '\n';
+    for (auto& [name, edges] : families) {
+        graph_t original(edges, n);
+        std::vector<double> potential = randomPotentials(n, 43);
+        graph_t negative(reweightByPotential(edges, potential), n);
+        std::vector<int> sources;
+        std::mt19937 rng(5);
+        while (sources.size() < 3) {
+            int s = rng() % n;
+            if (original.degree(s) > 0) sources.push_back(s);
+        }
+        std::vector<long long> baseline;
+        for (int o = -1; o < 3; o++) {
+            auto start = std::chrono::steady_clock::now();
+            std::vector<int> perm(n);
+            std::iota(perm.begin(), perm.end(), 0);
+            if (o >= 0) perm = vertexOrder(original, (Ordering) o);
+            double order_ms = o >= 0 ? elapsed(start) : 0;
+            graph_t graph = relabel(original, perm), neg = relabel(negative, perm);
+
+            DijkstraEngine<graph_t> engine(graph);
+            start = std::chrono::steady_clock::now();
+            for (int s : sources) engine.run(perm[s]);
+            double dijkstra_ms = elapsed(start) / sources.size();
+            BellmanFordEngine<graph_t> bf(neg, 1);
+            start = std::chrono::steady_clock::now();
+            auto result = bf.run(perm[sources.back()]);
+            double bf_ms = elapsed(start);
+
+            std::vector<long long> dist(n);
+            for (int v = 0; v < n; v++) dist[v] = engine.distance(v);
+            dist = permuteBack(dist, perm);
+            std::vector<long long> bf_dist = permuteBack(result.dist, perm);
+            bool same = true;
+            for (int v = 0; v < n; v++)
+                if (dist[v] != DijkstraEngine<graph_t>::INF) same = same && bf_dist[v] == dist[v] + (long long) (potential[sources.back()] - potential[v]);
+            if (o < 0) baseline = dist;
+            same = same && dist == baseline;
+            std::cout << std::setw(16) << name << std::setw(10) << (o < 0 ? "none" : names[o]) << std::setw(12) << meanGap(graph)
+                      << std::setw(14) << order_ms << std::setw(16) << dijkstra_ms << std::setw(18) << bf_ms << (same ? "yes" : "no") << '\n';
+        }
+    }
+
+    // floyd warshall touches the whole matrix every round, so only its early-out on unimproved groups can gain
+    const int fw_n = 2048;
+    std::vector<edge> fw_edges = geometricGraph(fw_n, 4, 42, 1000);
+    graph_t fw_graph(fw_edges, fw_n);
+    std::cout << '\n' << std::setw(16) << "floyd warshall" << std::setw(10) << "order" << "ms" << '\n';
+    for (int o = -1; o < 3; o++) {
+        std::vector<int> perm(fw_n);
+        std::iota(perm.begin(), perm.end(), 0);
+        if (o >= 0) perm = vertexOrder(fw_graph, (Ordering) o);
+        BlockedFloydWarshall fw(relabel(fw_edges, perm), fw_n, true);
+        auto start = std::chrono::steady_clock::now();
+        fw.run();
+        std::cout << std::setw(16) << "geometric 2048" << std::setw(10) << (o < 0 ? "none" : names[o]) << elapsed(start) << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+#include "Graph.h"
+
+/* cache locality vertex reordering - computes a permutation perm (perm[old id] = new id) & relabels graphs with it
+//   - BFS: breadth first order over the undirected view of the graph, so neighbors get nearby ids
+//   - RCM: reverse cuthill mckee - bfs from a pseudo peripheral vertex of each component, visiting unlabeled
+//     neighbors by increasing degree, then reversed; minimizes adjacency matrix bandwidth
+//   - DEGREE: descending total degree (stable), packs hub vertices of power-law graphs into a few cache lines
+//   - components are ordered one after another, starting from the vertex with the smallest id / degree
+// note: results computed on a relabeled graph are indexed by new ids - permuteBack(values, perm) restores old ids,
+//       vertex valued results (parents, paths) also need old = inversePermutation(perm)[new]
+*/
+enum Ordering { BFS_ORDER, RCM_ORDER, DEGREE_ORDER };
+
+namespace detail {
+    // undirected view of graph: both edge directions, weights dropped
+    template <typename G>
+    void symmetricAdjacency(const G& graph, std::vector<std::size_t>& offsets, std::vector<typename G::vertex_type>& adj) {
+        typedef typename G::vertex_type V;
+        std::size_t n = graph.vertexCount();
+        offsets.assign(n + 1, 0);
+        for (std::size_t u = 0; u < n; u++) {
+            offsets[u + 1] += graph.degree(u);
+            for (auto [v, weight] : graph.neighbors(u)) offsets[v + 1]++;
+        }
+        for (std::size_t v = 0; v < n; v++) offsets[v + 1] += offsets[v];
+        adj.resize(offsets[n]);
+        std::vector<std::size_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (std::size_t u = 0; u < n; u++) {
+            for (auto [v, weight] : graph.neighbors(u)) {
+                adj[cursor[u]++] = v;
+                adj[cursor[v]++] = (V) u;
+            }
+        }
+    }
+
+    // bfs over adjacency from root, returns vertices of last level & number of levels (visited uses epoch stamps)
+    template <typename V>
+    std::size_t lastLevel(const std::vector<std::size_t>& offsets, const std::vector<V>& adj, V root, std::vector<unsigned>& visited,
+                          unsigned epoch, std::vector<V>& queue, std::vector<V>& last) {
+        queue.assign(1, root);
+        visited[root] = epoch;
+        std::size_t levels = 0, head = 0;
+        while (head < queue.size()) {
+            std::size_t level_end = queue.size();
+            last.assign(queue.begin() + head, queue.end());
+            for (; head < level_end; head++) {
+                V u = queue[head];
+                for (std::size_t i = offsets[u]; i < offsets[u + 1]; i++) {
+                    if (visited[adj[i]] == epoch) continue;
+                    visited[adj[i]] = epoch;
+                    queue.push_back(adj[i]);
+                }
+            }
+            levels++;
+        }
+        return levels;
+    }
+}
+
+// old -> new permutation of graph's vertices
+template <typename G>
+std::vector<typename G::vertex_type> vertexOrder(const G& graph, Ordering ordering) {
+    typedef typename G::vertex_type V;
+    std::size_t n = graph.vertexCount();
+    std::vector<std::size_t> offsets;
+    std::vector<V> adj;
+    detail::symmetricAdjacency(graph, offsets, adj);
+    auto degree = [&](V v) { return offsets[v + 1] - offsets[v]; };
+
+    std::vector<V> order; // new -> old
+    order.reserve(n);
+    if (ordering == DEGREE_ORDER) {
+        order.resize(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](V a, V b) { return degree(a) > degree(b); });
+    } else {
+        // component roots are tried in id order (BFS) or by increasing degree (RCM)
+        std::vector<V> roots(n);
+        std::iota(roots.begin(), roots.end(), 0);
+        if (ordering == RCM_ORDER) std::stable_sort(roots.begin(), roots.end(), [&](V a, V b) { return degree(a) < degree(b); });
+        std::vector<bool> labeled(n, false);
+        std::vector<unsigned> visited(ordering == RCM_ORDER ? n : 0, 0);
+        std::vector<V> queue, last, next;
+        unsigned epoch = 0;
+        for (V root : roots) {
+            if (labeled[root]) continue;
+            if (ordering == RCM_ORDER) {
+                // george liu pseudo peripheral vertex: restart from a min degree vertex of the last level while depth grows
+                std::size_t levels = detail::lastLevel(offsets, adj, root, visited, ++epoch, queue, last);
+                for (int iter = 0; iter < 8; iter++) {
+                    V candidate = *std::min_element(last.begin(), last.end(), [&](V a, V b) { return degree(a) < degree(b); });
+                    std::size_t depth = detail::lastLevel(offsets, adj, candidate, visited, ++epoch, queue, last);
+                    if (depth <= levels) break;
+                    levels = depth;
+                    root = candidate;
+                }
+            }
+            std::size_t head = order.size();
+            order.push_back(root);
+            labeled[root] = true;
+            for (; head < order.size(); head++) {
+                V u = order[head];
+                next.clear();
+                for (std::size_t i = offsets[u]; i < offsets[u + 1]; i++) {
+                    if (labeled[adj[i]]) continue;
+                    labeled[adj[i]] = true;
+                    next.push_back(adj[i]);
+                }
+                if (ordering == RCM_ORDER) std::stable_sort(next.begin(), next.end(), [&](V a, V b) { return degree(a) < degree(b); });
+                order.insert(order.end(), next.begin(), next.end());
+            }
+        }
+        if (ordering == RCM_ORDER) std::reverse(order.begin(), order.end());
+    }
+    std::vector<V> perm(n);
+    for (std::size_t i = 0; i < n; i++) perm[order[i]] = (V) i;
+    return perm;
+}
+
+// new -> old mapping of an old -> new permutation
+template <typename V>
+std::vector<V> inversePermutation(const std::vector<V>& perm) {
+    std::vector<V> inverse(perm.size());
+    for (std::size_t v = 0; v < perm.size(); v++) inverse[perm[v]] = (V) v;
+    return inverse;
+}
+
+// values indexed by new ids -> values indexed by old ids
+template <typename T, typename V>
+std::vector<T> permuteBack(const std::vector<T>& values, const std::vector<V>& perm) {
+    std::vector<T> result(perm.size());
+    for (std::size_t v = 0; v < perm.size(); v++) result[v] = values[perm[v]];
+    return result;
+}
+
+// relabels endpoints of an edge list
+template <typename V>
+std::vector<edge> relabel(std::vector<edge> edges, const std::vector<V>& perm) {
+    for (auto& e : edges) {
+        e.from = perm[e.from];
+        e.to = perm[e.to];
+    }
+    return edges;
+}
+
+// relabeled copy of a csr graph: vertex perm[v] gets v's out-edges with relabeled targets (kept sorted by target)
+template <typename V, typename W>
+CSRGraph<V, W> relabel(const CSRGraph<V, W>& graph, const std::vector<V>& perm, unsigned threads = defaultThreads()) {
+    std::size_t n = graph.vertexCount();
+    if (perm.size() != n) throw std::invalid_argument("permutation size doesn't match vertex count");
+    std::vector<V> old = inversePermutation(perm);
+    std::vector<std::size_t> offsets(n + 1, 0);
+    for (std::size_t v = 0; v < n; v++) offsets[v + 1] = offsets[v] + graph.degree(old[v]);
+    std::vector<V> targets(offsets[n]);
+    std::vector<W> weights(offsets[n]);
+    parallelFor(0, n, [&](unsigned, std::size_t lo, std::size_t hi) {
+        std::vector<std::pair<V, W>> scratch;
+        for (std::size_t v = lo; v < hi; v++) {
+            scratch.clear();
+            for (auto [next, weight] : graph.neighbors(old[v])) scratch.push_back({perm[next], weight});
+            std::sort(scratch.begin(), scratch.end());
+            for (std::size_t i = 0; i < scratch.size(); i++) std::tie(targets[offsets[v] + i], weights[offsets[v] + i]) = scratch[i];
+        }
+    }, threads, 1 << 12);
+    return CSRGraph<V, W>(std::move(offsets), std::move(targets), std::move(weights));
+}
@@ -1,78 +1,70 @@
 #include <vector>
+#include <climits>
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
-#include <unordered_map>
-#include <unordered_set>
-#include <queue>
-
-struct edge {
-    double weight;
-    int from, to;
-    edge(int p_from, int p_to, double p_weight) : from(p_from), to(p_to), weight(p_weight) {}
-    edge(int p_from, int p_to) : from(p_from), to(p_to), weight(0) {}
-};
+#include "Graph.h"
+#include "PriorityQueues.h"
 
 std::vector<double> dist; // tracks distances from source vertex
 std::vector<int> bp; // tracks back pointer for vertices (for path reconstruction)
-std::unordered_map<int, std::vector<std::pair<int, double>>> adj_list; // graph adjacency list
+CSRGraph<int, double> graph; // graph in compressed sparse row format
 
 // initializes distances and back pointer vectors
 void initializeGraph(int src, int n) {
-    dist.resize(n, INT_MAX);
-    bp.resize(n, -1);
+    dist.assign(n, INT_MAX);
+    bp.assign(n, -1);
     dist[src] = 0;
 }
 
 /* dijkstra's algorithm - time complexity O((E + V) * log V)
 //   - calculates shortest path cost distance from source vertex to every other vertex
 //   - assumes all edge weights are non-negative and no self-loops
+// @template
+//   - Q: priority queue policy from PriorityQueues.h, heap entries are ordered {distance, vertex}
 // @params
 //   - src: id of source vertex
 //   - n: # of vertices
 */
+template <template <typename, typename> class Q = LazyHeap>
 void dijkstras(int src, int n) {
     initializeGraph(src, n);
     // min heap to quickly find next unvisited vertex with lowest path cost from source
-    typedef std::pair<int, double> pid;
-    std::priority_queue<pid, std::vector<pid>, std::greater<pid>> min_heap;
-    // set tracks visited vertices 
-    std::unordered_set<int> vis; 
-    min_heap.push({0, src});
+    Q<int, double> min_heap(graph);
+    // tracks visited vertices
+    std::vector<bool> vis(n, false);
+    min_heap.push(src, 0);
     while (!min_heap.empty()) {
-        auto curr = min_heap.top().second; min_heap.pop();
-        if (vis.count(curr)) continue;
-        vis.insert(curr);
-        for (auto& [next, weight] : adj_list[curr]) {
-            if (vis.count(next)) continue;
+        auto curr = min_heap.pop().second;
+        if (vis[curr]) continue;
+        vis[curr] = true;
+        for (auto [next, weight] : graph.neighbors(curr)) {
+            if (vis[next]) continue;
             if (dist[curr] + weight < dist[next]) {
                 dist[next] = dist[curr] + weight;
                 bp[next] = curr;
-                min_heap.push({dist[next], next});
+                min_heap.push(next, dist[next]);
             }
         }
     }
 }
 
 // resconstructs shortest cost path from source vertex to any other vertex
+// note: counts the path first & fills it from the back, so it is never reversed (see PathCache.h for cached trees)
 std::vector<int> constructShortestPath(int src, int dest) {
-    std::vector<int> path = {dest};
-    int prev = bp[dest];
-    while (prev != -1) {
-        path.push_back(prev);
-        prev = bp[prev];
-    }
-    std::reverse(path.begin(), path.end());
+    int length = 1;
+    for (int prev = bp[dest]; prev != -1; prev = bp[prev]) length++;
+    std::vector<int> path(length);
+    for (int v = dest; v != -1; v = bp[v]) path[--length] = v;
     return path;
 }
 
 // sample test case for djekstra's algorithm
 int main() {
     int src = 1, n = 5;
-    // graph represented by edge set and adjacency list
+    // graph represented by edge set and compressed sparse row adjacency
     std::vector<edge> edges = {{0, 1, 2}, {1, 2, 1}, {1, 3, 4}, {3, 4, 1}, {2, 3, 5}, {0, 4, 5}};
-    for (const auto& e: edges)
-        adj_list[e.from].push_back({e.to, e.weight});
+    graph = CSRGraph<int, double>(edges, n);
     // run djekstras on source vertex
     dijkstras(src, n);
     // prints distances between source vertex and any other vertex
@@ -1,97 +1,79 @@
-#include <vector>
-#include <iostream>
-#include <algorithm>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include "BinaryHeap.h"
 
-#define leftChild(x) (2 * x + 1)
-#define rightChild(x) (2 * x + 2)
-#define parent(x) ((x - 1) / 2)
+// times a callable in milliseconds
+template <typename F>
+double timeIt(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
 
-// creates binary heap compatiable with any data type and comparator (max heap by default)
-// note: unlike standard priority queue implementation, the container, however, is fixed (vector)
-template <typename T, typename C = std::less<T>>
-class BinaryHeap {
-    private:
-        std::vector<T> tree;
+// sample test case & benchmark for bulk heap operations (push_range, pop_k & merge)
+int main() {
+    BinaryHeap<int> heap(std::vector<int>{5, 1, 9});
+    std::vector<int> batch = {4, 8, 2, 7};
+    heap.push_range(batch.begin(), batch.end());
+    std::vector<int> out;
+    heap.pop_k(3, std::back_inserter(out));
+    std::cout << "Top 3 after push_range: ";
+    for (int v : out) std::cout << v << ' ';
+    std::cout << "\nRemaining heap: ";
+    heap.print();
 
-        // sifts root downward to restablish heap variant
-        void siftDown(std::size_t index, const std::size_t end) {
-            C cmp;
-            while (index <= end) {
-                std::size_t child = index;
-                if (leftChild(index) <= end && cmp(tree[child], tree[leftChild(index)]))
-                    child = leftChild(index);
-                if (rightChild(index) <= end && cmp(tree[child], tree[rightChild(index)]))
-                    child = rightChild(index);
-                if (index == child) return;
-                std::swap(tree[index], tree[child]);
-                index = child;
-            }
+    // push_range vs. pushing each element, for batches of m items into a heap of n items
+    std::mt19937 rng(42);
+    std::cout << '\n' << std::left << std::setw(12) << "n" << std::setw(12) << "m" << std::setw(16) << "push (ms)" << std::setw(16) << "push_range (ms)" << '\n';
+    for (std::size_t n : {1000000}) {
+        for (std::size_t m : {1000, 100000, 1000000, 4000000}) {
+            std::vector<int> base(n), items(m);
+            for (auto& v : base) v = rng();
+            for (auto& v : items) v = rng();
+            BinaryHeap<int> h1(base), h2(base);
+            double t1 = timeIt([&] { for (int v : items) h1.push(v); });
+            double t2 = timeIt([&] { h2.push_range(items.begin(), items.end()); });
+            std::cout << std::setw(12) << n << std::setw(12) << m << std::setw(16) << t1 << std::setw(16) << t2 << '\n';
         }
+    }
 
-        // sifts last leaf upward to restablish heap variant
-        void siftUp(std::size_t index) {
-            C cmp;
-            while (index > 0 && cmp(tree[parent(index)], tree[index])) {
-                std::swap(tree[parent(index)], tree[index]);
-                index = parent(index);
-            }
+    // pop_k vs. popping each element from a heap of n items
+    std::cout << '\n' << std::setw(12) << "n" << std::setw(12) << "k" << std::setw(16) << "pop (ms)" << std::setw(16) << "pop_k (ms)" << '\n';
+    for (std::size_t n : {1000000}) {
+        for (std::size_t k : {100, 10000, 100000, 500000, 1000000}) {
+            std::vector<int> base(n), o1, o2;
+            for (auto& v : base) v = rng();
+            BinaryHeap<int> h1(base), h2(base);
+            double t1 = timeIt([&] { for (std::size_t i = 0; i < k; i++) { o1.push_back(h1.top()); h1.pop(); } });
+            double t2 = timeIt([&] { h2.pop_k(k, std::back_inserter(o2)); });
+            if (o1 != o2) std::cout << "pop order mismatch!\n";
+            std::cout << std::setw(12) << n << std::setw(12) << k << std::setw(16) << t1 << std::setw(16) << t2 << '\n';
         }
-    
-    public:
-        heap(std::vector<T>& p_tree) : tree(p_tree) { heapify(); }
+    }
 
-        std::size_t size() const { return tree.size(); }
-        bool empty() const { return tree.size() == 0; }
-        
-        // accesses first element of heap
-        const T& top() const { return tree[0]; }
-        const T& front() const { return tree[0]; }
-
-        // inserts element into heap by creating new copy
-        void push(const T& val) { 
-            tree.push_back(val);
-            siftUp(tree.size() - 1);
-        }
-
-        // inserts element into heap by "moving" its contents
-        void push(T&& val) { 
-            tree.push_back(std::move(val));
-            siftUp(tree.size() - 1);
-        }
-
-        // removes root element from heap
-        void pop() {
-            if (tree.size() == 0) throw std::out_of_range("heap is empty, no element to remove");
-            std::swap(tree[0], tree.back());
-            tree.pop_back();
-            if (tree.size()) siftDown(0, tree.size() - 1);
-        }
-
-        // creates heap in O(n) time
-        void heapify() {
-            if (tree.size() <= 1) return;
-            std::size_t node = parent(tree.size() - 1);
-            while (true) {
-                siftDown(node, tree.size() - 1);
-                if (node == 0) break;
-                node--;
-            }
-        }
-
-        // sorts heap according to comparator
-        void heapSort() {
-            if (tree.size() <= 1) return;
-            std::size_t end = tree.size() - 1;
-            while (end > 0) {
-                std::swap(tree[0], tree[end]);
-                siftDown(0, --end);
-            }
-        }
-
-        // prints all elements in heap 
-        void print() const {
-            for (const T& node : tree)
-                std::cout << node << ' ';
-            std::cout << '\n';
+    // merge(other_heap) vs. its two paths: sifting up each element of the smaller heap, or heapifying the concatenation
+    std::cout << '\n' << std::setw(12) << "n" << std::setw(12) << "m" << std::setw(16) << "sift up (ms)" << std::setw(16) << "heapify (ms)"
+              << std::setw(16) << "merge (ms)" << '\n';
+    for (std::size_t n : {1000000}) {
+        for (std::size_t m : {1000, 10000, 100000, 300000, 1000000}) {
+            std::vector<int> base(n), items(m);
+            for (auto& v : base) v = rng();
+            for (auto& v : items) v = rng();
+            std::vector<int> all(base);
+            all.insert(all.end(), items.begin(), items.end());
+            BinaryHeap<int> h1(base), h3(base), other(items), h2;
+            double t1 = timeIt([&] { for (int v : items) h1.push(v); });
+            double t2 = timeIt([&] { h2 = BinaryHeap<int>(std::move(all)); });
+            double t3 = timeIt([&] { h3.merge(other); });
+            std::vector<int> o1, o2, o3;
+            h1.pop_k(100, std::back_inserter(o1));
+            h2.pop_k(100, std::back_inserter(o2));
+            h3.pop_k(100, std::back_inserter(o3));
+            if (o1 != o2 || o1 != o3 || h1.size() != h3.size() || !other.empty()) std::cout << "merge mismatch!\n";
+            std::cout << std::setw(12) << n << std::setw(12) << m << std::setw(16) << t1 << std::setw(16) << t2 << std::setw(16) << t3 << '\n';
         }
-};
\ No newline at end of file
+    }
+    return 0;
+}
@@ -0,0 +1,161 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+
+#define leftChild(x) (2 * x + 1)
+#define rightChild(x) (2 * x + 2)
+#define parent(x) ((x - 1) / 2)
+
+// creates binary heap compatiable with any data type and comparator (max heap by default)
+// note: unlike standard priority queue implementation, the container, however, is fixed (vector)
+template <typename T, typename C = std::less<T>>
+class BinaryHeap {
+    private:
+        std::vector<T> tree;
+
+        // sifts root downward to restablish heap variant
+        void siftDown(std::size_t index, const std::size_t end) {
+            C cmp;
+            while (index <= end) {
+                std::size_t child = index;
+                if (leftChild(index) <= end && cmp(tree[child], tree[leftChild(index)]))
+                    child = leftChild(index);
+                if (rightChild(index) <= end && cmp(tree[child], tree[rightChild(index)]))
+                    child = rightChild(index);
+                if (index == child) return;
+                std::swap(tree[index], tree[child]);
+                index = child;
+            }
+        }
+
+        // sifts last leaf upward to restablish heap variant
+        void siftUp(std::size_t index) {
+            C cmp;
+            while (index > 0 && cmp(tree[parent(index)], tree[index])) {
+                std::swap(tree[parent(index)], tree[index]);
+                index = parent(index);
+            }
+        }
+    
+        // restores heap variant after elements [n, size) were appended, picking the cheaper of heapify & per-element sift up
+        void restoreAfterAppend(std::size_t n) {
+            std::size_t m = tree.size() - n;
+            if (m == 0) return;
+            if (m * std::log2(tree.size()) > 2 * tree.size())
+                heapify();
+            else
+                for (std::size_t i = n; i < tree.size(); i++) siftUp(i);
+        }
+
+    public:
+        BinaryHeap() {}
+        BinaryHeap(const std::vector<T>& p_tree) : tree(p_tree) { heapify(); }
+        BinaryHeap(std::vector<T>&& p_tree) : tree(std::move(p_tree)) { heapify(); }
+
+        std::size_t size() const { return tree.size(); }
+        bool empty() const { return tree.size() == 0; }
+        
+        // accesses first element of heap
+        const T& top() const { return tree[0]; }
+        const T& front() const { return tree[0]; }
+
+        // inserts element into heap by creating new copy
+        void push(const T& val) { 
+            tree.push_back(val);
+            siftUp(tree.size() - 1);
+        }
+
+        // inserts element into heap by "moving" its contents
+        void push(T&& val) { 
+            tree.push_back(std::move(val));
+            siftUp(tree.size() - 1);
+        }
+
+        // removes root element from heap
+        void pop() {
+            if (tree.size() == 0) throw std::out_of_range("heap is empty, no element to remove");
+            std::swap(tree[0], tree.back());
+            tree.pop_back();
+            if (tree.size()) siftDown(0, tree.size() - 1);
+        }
+
+        // removes all elements, keeping allocated storage
+        void clear() { tree.clear(); }
+
+        // creates heap in O(n) time
+        void heapify() {
+            if (tree.size() <= 1) return;
+            std::size_t node = parent(tree.size() - 1);
+            while (true) {
+                siftDown(node, tree.size() - 1);
+                if (node == 0) break;
+                node--;
+            }
+        }
+
+        // inserts range of elements - rebuilds heap bottom-up in O(n + m) when batch is large, otherwise sifts up each element
+        template <typename It>
+        void push_range(It first, It last) {
+            std::size_t n = tree.size();
+            tree.insert(tree.end(), first, last);
+            restoreAfterAppend(n);
+        }
+
+        // removes up to k root elements, writing them in priority order to out
+        // large batches select & sort the top k in O(n + k log k) instead of popping k times in O(k log n)
+        template <typename Out>
+        Out pop_k(std::size_t k, Out out) {
+            C cmp;
+            k = std::min(k, tree.size());
+            if (k == 0) return out;
+            std::size_t n = tree.size();
+            if (k * std::log2(n) * 2 <= k * std::log2(k + 1) + 3 * n) {
+                for (std::size_t i = 0; i < k; i++) {
+                    *out++ = std::move(tree[0]);
+                    pop();
+                }
+                return out;
+            }
+            auto higher = [&cmp](const T& a, const T& b) { return cmp(b, a); };
+            std::nth_element(tree.begin(), tree.begin() + (k - 1), tree.end(), higher);
+            std::sort(tree.begin(), tree.begin() + k, higher);
+            out = std::move(tree.begin(), tree.begin() + k, out);
+            tree.erase(tree.begin(), tree.begin() + k);
+            heapify();
+            return out;
+        }
+
+        // melds another heap into this one, leaving other empty
+        void merge(BinaryHeap& other) {
+            if (other.tree.size() > tree.size()) std::swap(tree, other.tree);
+            std::size_t n = tree.size();
+            tree.insert(tree.end(), std::make_move_iterator(other.tree.begin()), std::make_move_iterator(other.tree.end()));
+            other.tree.clear();
+            restoreAfterAppend(n);
+        }
+
+        // sorts heap according to comparator
+        void heapSort() {
+            if (tree.size() <= 1) return;
+            std::size_t end = tree.size() - 1;
+            while (end > 0) {
+                std::swap(tree[0], tree[end]);
+                siftDown(0, --end);
+            }
+        }
+
+        // prints all elements in heap 
+        void print() const {
+            for (const T& node : tree)
+                std::cout << node << ' ';
+            std::cout << '\n';
+        }
+};
+
+#undef leftChild
+#undef rightChild
+#undef parent
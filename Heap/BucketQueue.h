@@ -0,0 +1,66 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+
+// bucket queue (dial's algorithm) - monotone min priority queue for small integer keys (O(1) push, O(C) worst case pop)
+//   - elements are stored as {key, value} pairs in a circular array of C + 1 buckets indexed by key % (C + 1)
+//   - every key in queue must lie in [last popped key, last popped key + C], where C is the max edge weight
+template <typename T, typename K = std::uint64_t>
+class BucketQueue {
+    public:
+        typedef std::pair<K, T> value_type;
+
+    private:
+        mutable std::vector<std::vector<value_type>> buckets;
+        mutable K curr; // key of bucket currently being drained (lower bound of every key in queue)
+        std::size_t m_size;
+
+        // advances to next non-empty bucket
+        void pull() const {
+            while (buckets[curr % buckets.size()].empty()) curr++;
+        }
+
+    public:
+        BucketQueue(K max_weight) : buckets(max_weight + 1), curr(0), m_size(0) {}
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        // accesses element with minimum key
+        const value_type& top() const {
+            if (m_size == 0) throw std::out_of_range("queue is empty, no element to access");
+            pull();
+            return buckets[curr % buckets.size()].back();
+        }
+        const value_type& front() const { return top(); }
+
+        // inserts element into queue, key must lie within C of last popped key
+        void push(const value_type& val) {
+            if (val.first < curr || val.first - curr >= buckets.size()) throw std::invalid_argument("key is outside of bucket range");
+            buckets[val.first % buckets.size()].push_back(val);
+            m_size++;
+        }
+
+        void push(value_type&& val) {
+            if (val.first < curr || val.first - curr >= buckets.size()) throw std::invalid_argument("key is outside of bucket range");
+            buckets[val.first % buckets.size()].push_back(std::move(val));
+            m_size++;
+        }
+
+        // removes element with minimum key
+        void pop() {
+            if (m_size == 0) throw std::out_of_range("queue is empty, no element to remove");
+            pull();
+            buckets[curr % buckets.size()].pop_back();
+            m_size--;
+        }
+
+        // removes all elements and resets the monotone lower bound
+        void clear() {
+            for (auto& bucket : buckets) bucket.clear();
+            curr = 0;
+            m_size = 0;
+        }
+};
@@ -0,0 +1,53 @@
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include "ExternalHeap.h"
+
+// simulates an event queue: pops the earliest timestamp & schedules a later one, after n initial events
+template <typename Q>
+double simulate(Q& queue, std::size_t n, std::uint64_t& checksum) {
+    std::mt19937_64 rng(42);
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n; i++)
+        queue.push(rng() % (1ull << 40));
+    checksum = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        std::uint64_t t = queue.top();
+        queue.pop();
+        checksum = checksum * 31 + t;
+        if (i % 2 == 0) queue.push(t + rng() % (1ull << 20));
+    }
+    while (!queue.empty()) queue.pop();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+// sample test case & benchmark for external memory sequence heap
+int main() {
+    // tiny memory budget forces several spills & a group merge
+    ExternalHeap<int> small(64, ".", 16);
+    for (int i = 0; i < 40; i++)
+        small.push((i * 17) % 41);
+    std::cout << "runs on disk: " << small.runCount() << ", pop order: ";
+    while (!small.empty()) {
+        std::cout << small.top() << ' ';
+        small.pop();
+    }
+    std::cout << '\n';
+
+    // throughput as queue outgrows an 8MB memory budget (1M timestamps)
+    std::cout << '\n' << std::left << std::setw(12) << "events" << std::setw(20) << "in-memory (Mops/s)"
+              << std::setw(20) << "external (Mops/s)" << std::setw(16) << "spilled (MB)" << '\n';
+    for (std::size_t n : {1ull << 19, 1ull << 21, 1ull << 23}) {
+        BinaryHeap<std::uint64_t, std::greater<std::uint64_t>> mem;
+        ExternalHeap<std::uint64_t> ext(8 << 20);
+        std::uint64_t c1, c2;
+        double t1 = simulate(mem, n, c1);
+        double t2 = simulate(ext, n, c2);
+        if (c1 != c2) std::cout << "pop order mismatch!\n";
+        double ops = 3.5 * n / 1e6; // n pushes + n pops + n/2 pushes & pops
+        std::cout << std::setw(12) << n << std::setw(20) << ops / t1 << std::setw(20) << ops / t2
+                  << std::setw(16) << ext.spilledElements() * sizeof(std::uint64_t) / double(1 << 20) << '\n';
+    }
+    return 0;
+}
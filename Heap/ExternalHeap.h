@@ -0,0 +1,244 @@
+#pragma once
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <memory>
+#include <future>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <type_traits>
+#include "BinaryHeap.h"
+
+// external memory sequence heap - min priority queue that can outgrow memory by spilling sorted runs to disk
+//   - insertions go to a small in-memory binary heap, which is written to disk as one sorted run when full
+//   - pops take the smaller of the insertion heap's root & the head of a k-way merge over all runs
+//   - each run is read in blocks with the next block prefetched asynchronously, so disk i/o stays sequential
+//   - runs have levels like a sequence heap: spilled runs are level 0, & once a level holds max_fan_in runs exactly
+//     those runs are merged into one run of the next level, so every element is rewritten once per level
+//     (O(N/B * log_{M/B}(N/B)) i/o) instead of once per spill
+//   - pops merge across every live run, so the total # of live runs is capped at max_fan_in as well: when a spill
+//     exceeds it, the runs of the lowest levels are merged into one run of the level above them
+//   - max_fan_in is sized so that max_fan_in + 1 runs (two blocks each) & one output block fit in half the budget,
+//     the insertion heap gets the other half, so memory_budget bounds resident element storage at every level count
+//   - a run's file is closed & removed as soon as the run is exhausted
+// note: elements must be trivially copyable since they are written to disk as raw bytes, budgets below 14 blocks are
+//       raised to the minimum fan in of 2 (two runs merged at once)
+template <typename T, typename C = std::less<T>>
+class ExternalHeap {
+    static_assert(std::is_trivially_copyable<T>::value, "external heap elements must be trivially copyable");
+
+    private:
+        // sorted run stored on disk, read block by block with double buffering
+        struct Run {
+            std::FILE* file;
+            std::string path;
+            std::vector<T> block, next; // current block & prefetched block
+            std::size_t pos; // position of head element in current block
+            std::future<std::size_t> pending; // prefetch of next block
+            std::size_t level; // 0 for spilled runs, l + 1 for a merge of runs up to level l
+
+            ~Run() {
+                if (pending.valid()) pending.wait();
+                if (file) std::fclose(file);
+                std::remove(path.c_str());
+            }
+
+            const T& head() const { return block[pos]; }
+
+            void prefetch(std::size_t block_size) {
+                next.resize(block_size);
+                pending = std::async(std::launch::async, [this] { return std::fread(next.data(), sizeof(T), next.size(), file); });
+            }
+
+            // advances to next element, returns false when run is exhausted
+            bool advance(std::size_t block_size) {
+                if (++pos < block.size()) return true;
+                std::size_t count = pending.get();
+                if (count == 0) return false;
+                next.resize(count);
+                std::swap(block, next);
+                pos = 0;
+                prefetch(block_size);
+                return true;
+            }
+        };
+
+        // merge heap entries are ordered so the smallest run head is at the root
+        struct Head {
+            T val;
+            std::size_t run;
+        };
+        struct HeadCmp {
+            bool operator()(const Head& a, const Head& b) const { return C()(b.val, a.val); }
+        };
+        // reverses comparator so binary heap (max heap) keeps smallest element at root
+        struct ReverseCmp {
+            bool operator()(const T& a, const T& b) const { return C()(b, a); }
+        };
+
+        BinaryHeap<T, ReverseCmp> insertion_heap;
+        std::vector<std::unique_ptr<Run>> runs; // slots, null once a run is exhausted
+        std::vector<std::size_t> free_slots;
+        std::vector<std::vector<std::size_t>> levels; // slots of live runs per level
+        std::size_t live_runs = 0;
+        BinaryHeap<Head, HeadCmp> merge_heap;
+        std::string spill_dir;
+        std::size_t insertion_capacity; // max elements held by insertion heap
+        std::size_t block_size; // elements per disk block
+        std::size_t max_fan_in; // max runs per level & max live runs overall (each run holds two blocks in memory)
+        std::size_t m_size, run_id;
+        std::size_t spilled; // total elements written to disk (including group merges)
+
+        // creates & opens an empty run file for writing
+        std::unique_ptr<Run> openRun() {
+            auto run = std::make_unique<Run>();
+            run->path = spill_dir + "/xheap_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + "_" + std::to_string(run_id++) + ".run";
+            run->file = std::fopen(run->path.c_str(), "w+b");
+            if (!run->file) throw std::runtime_error("failed to create run file " + run->path);
+            run->pos = 0;
+            return run;
+        }
+
+        void writeBlock(Run& run, const std::vector<T>& out) {
+            if (std::fwrite(out.data(), sizeof(T), out.size(), run.file) != out.size())
+                throw std::runtime_error("failed to write run file " + run.path);
+            spilled += out.size();
+        }
+
+        // rewinds a written run & loads its first block, then registers it with the merge heap & its level
+        void addRun(std::unique_ptr<Run> run, std::size_t level) {
+            std::fflush(run->file);
+            std::rewind(run->file);
+            run->block.resize(block_size);
+            run->block.resize(std::fread(run->block.data(), sizeof(T), block_size, run->file));
+            run->prefetch(block_size);
+            if (run->block.empty()) return;
+            run->level = level;
+            std::size_t slot = runs.size();
+            if (!free_slots.empty()) {
+                slot = free_slots.back();
+                free_slots.pop_back();
+            } else
+                runs.emplace_back();
+            merge_heap.push({run->head(), slot});
+            runs[slot] = std::move(run);
+            if (levels.size() <= level) levels.resize(level + 1);
+            levels[level].push_back(slot);
+            live_runs++;
+        }
+
+        // closes & removes file of an exhausted run
+        void releaseRun(std::size_t slot) {
+            auto& level = levels[runs[slot]->level];
+            level.erase(std::find(level.begin(), level.end(), slot));
+            runs[slot].reset();
+            free_slots.push_back(slot);
+            live_runs--;
+        }
+
+        // moves to next element of run in slot, returns false (after releasing it) when run is exhausted
+        bool advanceRun(std::size_t slot) {
+            if (runs[slot]->advance(block_size)) return true;
+            releaseRun(slot);
+            return false;
+        }
+
+        // drains insertion heap into a sorted run on disk
+        void spill() {
+            auto run = openRun();
+            std::vector<T> out;
+            out.reserve(block_size);
+            while (!insertion_heap.empty()) {
+                insertion_heap.pop_k(block_size, std::back_inserter(out));
+                writeBlock(*run, out);
+                out.clear();
+            }
+            addRun(std::move(run), 0);
+            for (std::size_t level = 0; level < levels.size(); level++)
+                if (levels[level].size() >= max_fan_in) mergeLevels(level, level);
+            // too many live runs across levels: merges lowest levels holding at least two runs into the level above
+            while (live_runs > max_fan_in) {
+                std::size_t last = 0, count = levels[0].size();
+                while (count < 2) count += levels[++last].size();
+                mergeLevels(0, last);
+            }
+        }
+
+        // k-way merges the runs of levels first..last into a single run of level last + 1
+        void mergeLevels(std::size_t first, std::size_t last) {
+            std::vector<std::size_t> group;
+            for (std::size_t level = first; level <= last; level++) group.insert(group.end(), levels[level].begin(), levels[level].end());
+            BinaryHeap<Head, HeadCmp> group_heap;
+            for (std::size_t slot : group) group_heap.push({runs[slot]->head(), slot});
+            auto merged = openRun();
+            std::vector<T> out;
+            out.reserve(block_size);
+            while (!group_heap.empty()) {
+                Head h = group_heap.top();
+                group_heap.pop();
+                out.push_back(h.val);
+                if (out.size() == block_size) {
+                    writeBlock(*merged, out);
+                    out.clear();
+                }
+                if (advanceRun(h.run)) group_heap.push({runs[h.run]->head(), h.run});
+            }
+            writeBlock(*merged, out);
+            // heads of the merged runs are stale, so the merge heap is rebuilt from the remaining live runs
+            merge_heap = BinaryHeap<Head, HeadCmp>();
+            for (std::size_t slot = 0; slot < runs.size(); slot++)
+                if (runs[slot]) merge_heap.push({runs[slot]->head(), slot});
+            addRun(std::move(merged), last + 1);
+        }
+
+        // removes smallest head among runs, refilling merge heap from the same run (or releasing it when exhausted)
+        T popRunHead() {
+            Head h = merge_heap.top();
+            merge_heap.pop();
+            if (advanceRun(h.run)) merge_heap.push({runs[h.run]->head(), h.run});
+            return h.val;
+        }
+
+    public:
+        // memory_budget: bytes of element storage held in memory (insertion heap + run blocks of all live runs)
+        // block_bytes: size of each sequential disk read/write
+        ExternalHeap(std::size_t memory_budget = 64 << 20, std::string p_spill_dir = std::filesystem::temp_directory_path().string(),
+                     std::size_t block_bytes = 1 << 20)
+            : spill_dir(std::move(p_spill_dir)),
+              insertion_capacity(std::max<std::size_t>(1, memory_budget / 2 / sizeof(T))),
+              block_size(std::max<std::size_t>(1, block_bytes / sizeof(T))),
+              max_fan_in((std::max<std::size_t>(7, memory_budget / 2 / block_bytes) - 3) / 2),
+              m_size(0), run_id(0), spilled(0) {}
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        std::size_t runCount() const { return live_runs; }
+        std::size_t spilledElements() const { return spilled; }
+
+        // accesses smallest element of heap
+        const T& top() const {
+            if (m_size == 0) throw std::out_of_range("heap is empty, no element to access");
+            if (merge_heap.empty()) return insertion_heap.top();
+            if (insertion_heap.empty() || C()(merge_heap.top().val, insertion_heap.top())) return merge_heap.top().val;
+            return insertion_heap.top();
+        }
+        const T& front() const { return top(); }
+
+        // inserts element, spilling insertion heap to disk when it reaches its share of the memory budget
+        void push(const T& val) {
+            if (insertion_heap.size() >= insertion_capacity) spill();
+            insertion_heap.push(val);
+            m_size++;
+        }
+
+        // removes smallest element of heap
+        void pop() {
+            if (m_size == 0) throw std::out_of_range("heap is empty, no element to remove");
+            if (!merge_heap.empty() && (insertion_heap.empty() || C()(merge_heap.top().val, insertion_heap.top()))) {
+                popRunHead();
+            } else
+                insertion_heap.pop();
+            m_size--;
+        }
+};
@@ -0,0 +1,237 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+
+// creates fibonacci heap compatible with any data type and comparator (min heap by default, like BinaryHeap with std::greater)
+//   - push returns a node handle which stays valid until the node is popped, so keys can be lowered in O(1) amortized
+//   - pop melds the children of the root into the root list & merges roots of equal degree (O(log n) amortized)
+template <typename T = int, typename C = std::greater<T>>
+class FibonacciHeap {
+    private:
+        struct Node {
+            int degree; // number of children nodes
+            Node* parent, *child;
+            Node* left, *right; // links nodes at same depth via circular doubly linked list 
+
+            T key; // key value stored by node
+            bool mark; // indicates whether the node has lost a child (for optimizing time complexity)
+
+            Node(const T& p_key) : degree(0), parent(nullptr), child(nullptr), left(this), right(this), key(p_key), mark(false) {};
+        };
+
+        Node* min_root;
+        int m_size; // total number of nodes
+        C cmp; // cmp(a, b) is true if a belongs below b
+
+        // adds heap to root list
+        void addHeap(Node* root) {
+            root->parent = nullptr;
+            root->mark = false;
+            if (!min_root) {
+                min_root = root;
+                root->left = root->right = root;
+            } else 
+                addSibling(root, min_root);
+            if (cmp(min_root->key, root->key))
+                min_root = root;
+        }
+
+        // merges two detached heaps - root that belongs lower becomes child of the other root
+        Node* mergeHeaps(Node* root1, Node* root2) {
+            if (cmp(root1->key, root2->key))
+                std::swap(root1, root2);
+            if (root1->child)
+                addSibling(root2, root1->child);
+            else {
+                root1->child = root2;
+                root2->left = root2->right = root2;
+            }
+            root1->degree++;
+            root2->parent = root1;
+            root2->mark = false;
+            return root1;
+        }
+
+        // merges roots with same degree, ensuring fibonacci heap remains compact, then finds new min root
+        void consolidateTrees() {
+            if (!min_root) return;
+            std::vector<Node*> roots;
+            Node* root = min_root;
+            do {
+                roots.push_back(root);
+                root = root->right;
+            } while (root != min_root);
+            // degree of a root is at most log_phi(n) < 64
+            Node* root_list[64] = {};
+            for (Node* node : roots) {
+                node->left = node->right = node;
+                while (root_list[node->degree]) {
+                    Node* other = root_list[node->degree];
+                    root_list[node->degree] = nullptr;
+                    node = mergeHeaps(node, other);
+                }
+                root_list[node->degree] = node;
+            }
+            min_root = nullptr;
+            for (Node* node : root_list)
+                if (node) addHeap(node);
+        }
+
+        // moves node from its parent's child list to root list
+        void cut(Node* node, Node* parent) {
+            if (node->right == node)
+                parent->child = nullptr;
+            else {
+                linkSiblings(node->left, node->right);
+                if (parent->child == node) parent->child = node->right;
+            }
+            parent->degree--;
+            addHeap(node);
+        }
+
+        // cuts marked ancestors until an unmarked one is found, which gets marked
+        void cascadingCut(Node* node) {
+            while (node->parent) {
+                if (!node->mark) {
+                    node->mark = true;
+                    return;
+                }
+                Node* parent = node->parent;
+                cut(node, parent);
+                node = parent;
+            }
+        }
+
+        // frees every node in sibling list of root & their subtrees
+        //   - iterative with an explicit stack of child lists, since cascading cuts can leave trees of height O(n)
+        void destroy(Node* root) {
+            std::vector<Node*> lists;
+            if (root) lists.push_back(root);
+            while (!lists.empty()) {
+                Node* first = lists.back();
+                lists.pop_back();
+                Node* curr = first;
+                do {
+                    Node* next = curr->right;
+                    if (curr->child) lists.push_back(curr->child);
+                    delete curr;
+                    curr = next;
+                } while (curr != first);
+            }
+        }
+
+        // helper function to connect two adjacent nodes in heap
+        inline void linkSiblings(Node* prev, Node* next) {
+            prev->right = next;
+            next->left = prev;
+        }
+
+        // helper function to establish new sibling connection in heap
+        inline void addSibling(Node* node, Node* sibling) {
+            node->right = sibling;
+            node->left = sibling->left;
+            sibling->left->right = node;
+            sibling->left = node;
+        }
+
+        // represents fibonacci heap using directory-like notation (simulates depth)
+        //   - iterative like destroy: one {next node, first node} frame per depth of the current path
+        void print(Node* root) {
+            if (!root) {
+                std::cout << 'X' << '\n';
+                return;
+            }
+            std::vector<std::pair<Node*, Node*>> frames = {{root, root}};
+            while (!frames.empty()) {
+                int depth = frames.size() - 1;
+                Node* curr = frames.back().first;
+                for (int i = 0; i < depth - 1; i++) {
+                    std::cout << "  ";
+                }
+                if (depth >= 1)
+                    std::cout << "|-";
+                std::cout << curr->key << '\n';
+                // null marks a sibling list whose nodes have all been printed
+                frames.back().first = curr->right != frames.back().second ? curr->right : nullptr;
+                if (curr->child) frames.push_back({curr->child, curr->child});
+                while (!frames.empty() && !frames.back().first) frames.pop_back();
+            }
+        }
+
+    public:
+        typedef Node* handle;
+
+        FibonacciHeap() : min_root(nullptr), m_size(0) {};
+        ~FibonacciHeap() { destroy(min_root); }
+
+        FibonacciHeap(const FibonacciHeap&) = delete;
+        FibonacciHeap& operator=(const FibonacciHeap&) = delete;
+        
+        bool empty() const { return m_size == 0; }
+        int size() const { return m_size; }
+
+        const T& top() const { return min_root->key; }
+        const T& front() const { return min_root->key; }
+
+        // inserts element into fibonacci heap by creating new heap, returns handle of its node
+        handle push(const T& val) {
+            // creates new heap with one node
+            Node* root = new Node(val);
+            // adds new heap to root list
+            addHeap(root);
+            m_size++;
+            return root;
+        }
+
+        // replaces key of node with one that doesn't belong lower, cutting node from its parent if heap order breaks
+        void decrease(handle node, const T& val) {
+            node->key = val;
+            Node* parent = node->parent;
+            if (parent && cmp(parent->key, node->key)) {
+                cut(node, parent);
+                cascadingCut(parent);
+            }
+            if (cmp(min_root->key, node->key))
+                min_root = node;
+        }
+        
+        // deletes min element of fibonacci heap, melds its children into root list
+        void pop() {
+            // setup tree to delete min root
+            Node* child = min_root->child;
+            Node* new_root = (min_root->left != min_root ? min_root->left : nullptr);
+            if (new_root)
+                linkSiblings(min_root->left, min_root->right);
+            // delete min root
+            delete min_root;
+            m_size--;
+            min_root = new_root;
+            // update rest of fibonacci heap
+            if (child) {
+                Node* temp = child;
+                do {
+                    Node* next = child->right;
+                    addHeap(child);
+                    child = next;
+                } while (child != temp);
+            }
+            // merges trees with same degrees & updates new min root
+            consolidateTrees();
+        }
+
+        // removes all elements
+        void clear() {
+            destroy(min_root);
+            min_root = nullptr;
+            m_size = 0;
+        }
+
+        // prints fibonacci heap using directory-like notation
+        void print() {
+            print(min_root);
+            std::cout << '\n';
+        }
+};
@@ -0,0 +1,49 @@
+#include <set>
+#include <random>
+#include "MinMaxHeap.h"
+
+// sample test case for min-max heap
+int main() {
+    MinMaxHeap<int> heap(std::vector<int>{8, 71, 41, 31, 10, 11, 16, 46, 51, 31, 21, 13});
+    heap.print();
+    std::cout << "min: " << heap.min() << ", max: " << heap.max() << '\n';
+    heap.pop_min();
+    heap.pop_max();
+    std::cout << "after pop_min & pop_max -> min: " << heap.min() << ", max: " << heap.max() << '\n';
+
+    // bounded heap keeps the 5 largest elements of a stream
+    MinMaxHeap<int> top_k(5);
+    for (int v : {4, 19, 7, 33, 2, 25, 11, 40, 1, 18})
+        top_k.push(v);
+    std::cout << "top 5 of stream: ";
+    while (!top_k.empty()) {
+        std::cout << top_k.max() << ' ';
+        top_k.pop_max();
+    }
+    std::cout << '\n';
+
+    // randomized check against std::multiset
+    std::mt19937 rng(42);
+    MinMaxHeap<int> h;
+    std::multiset<int> ref;
+    for (int i = 0; i < 100000; i++) {
+        int op = rng() % 3;
+        if (op == 0 || ref.empty()) {
+            int v = rng() % 1000;
+            h.push(v);
+            ref.insert(v);
+        } else if (op == 1) {
+            h.pop_min();
+            ref.erase(ref.begin());
+        } else {
+            h.pop_max();
+            ref.erase(std::prev(ref.end()));
+        }
+        if (!ref.empty() && (h.min() != *ref.begin() || h.max() != *ref.rbegin())) {
+            std::cout << "mismatch at operation " << i << '\n';
+            return 1;
+        }
+    }
+    std::cout << "randomized check passed" << '\n';
+    return 0;
+}
@@ -0,0 +1,167 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+// creates min-max heap (double ended priority queue) compatible with any data type and comparator
+//   - even levels (root = level 0) are ordered as min heap, odd levels as max heap
+//   - min() & max() in O(1), push, pop_min & pop_max in O(log n), heapify in O(n)
+//   - optional capacity: pushing into a full heap evicts the min element (keeps top-k max elements)
+template <typename T, typename C = std::less<T>>
+class MinMaxHeap {
+    private:
+        std::vector<T> tree;
+        std::size_t m_capacity;
+
+        static std::size_t leftChild(std::size_t x) { return 2 * x + 1; }
+        static std::size_t parent(std::size_t x) { return (x - 1) / 2; }
+
+        static bool isMinLevel(std::size_t index) {
+            int level = 0;
+            for (index++; index > 1; index >>= 1) level++;
+            return level % 2 == 0;
+        }
+
+        // on min levels element a is "better" if it is smaller, on max levels if it is larger
+        template <bool Max>
+        static bool better(const T& a, const T& b) {
+            C cmp;
+            return Max ? cmp(b, a) : cmp(a, b);
+        }
+
+        // sifts element downward through its children & grandchildren on levels of the same type
+        template <bool Max>
+        void siftDown(std::size_t index) {
+            while (leftChild(index) < tree.size()) {
+                // finds best element among children & grandchildren
+                std::size_t best = leftChild(index);
+                for (std::size_t c = leftChild(index); c <= leftChild(index) + 1 && c < tree.size(); c++) {
+                    if (better<Max>(tree[c], tree[best])) best = c;
+                    for (std::size_t g = leftChild(c); g <= leftChild(c) + 1 && g < tree.size(); g++)
+                        if (better<Max>(tree[g], tree[best])) best = g;
+                }
+                if (!better<Max>(tree[best], tree[index])) return;
+                std::swap(tree[index], tree[best]);
+                if (parent(best) == index) return;
+                // grandchild moved down two levels, may now violate ordering with its parent (opposite level type)
+                if (better<Max>(tree[parent(best)], tree[best]))
+                    std::swap(tree[parent(best)], tree[best]);
+                index = best;
+            }
+        }
+
+        void siftDown(std::size_t index) {
+            if (isMinLevel(index)) siftDown<false>(index);
+            else siftDown<true>(index);
+        }
+
+        // sifts element upward through grandparents on levels of the same type
+        template <bool Max>
+        void siftUpLevels(std::size_t index) {
+            while (index > 2 && better<Max>(tree[index], tree[parent(parent(index))])) {
+                std::swap(tree[index], tree[parent(parent(index))]);
+                index = parent(parent(index));
+            }
+        }
+
+        // sifts last leaf upward to restablish heap variant
+        void siftUp(std::size_t index) {
+            if (index == 0) return;
+            std::size_t p = parent(index);
+            if (isMinLevel(index)) {
+                if (better<true>(tree[index], tree[p])) {
+                    std::swap(tree[index], tree[p]);
+                    siftUpLevels<true>(p);
+                } else
+                    siftUpLevels<false>(index);
+            } else {
+                if (better<false>(tree[index], tree[p])) {
+                    std::swap(tree[index], tree[p]);
+                    siftUpLevels<false>(p);
+                } else
+                    siftUpLevels<true>(index);
+            }
+        }
+
+        std::size_t maxIndex() const {
+            if (tree.size() <= 2) return tree.size() - 1;
+            return better<true>(tree[2], tree[1]) ? 2 : 1;
+        }
+
+        // removes element at index by moving last leaf into its place
+        void erase(std::size_t index) {
+            tree[index] = std::move(tree.back());
+            tree.pop_back();
+            if (index < tree.size()) siftDown(index);
+        }
+
+        // inserts element if heap has room, otherwise replaces min element when val is larger
+        template <typename V>
+        bool insert(V&& val) {
+            if (tree.size() < m_capacity) {
+                tree.push_back(std::forward<V>(val));
+                siftUp(tree.size() - 1);
+                return true;
+            }
+            if (m_capacity == 0 || !better<true>(val, tree[0])) return false;
+            tree[0] = std::forward<V>(val);
+            siftDown(0);
+            return true;
+        }
+
+    public:
+        MinMaxHeap(std::size_t p_capacity = std::numeric_limits<std::size_t>::max()) : m_capacity(p_capacity) {}
+        MinMaxHeap(std::vector<T> p_tree) : tree(std::move(p_tree)), m_capacity(std::numeric_limits<std::size_t>::max()) { heapify(); }
+
+        std::size_t size() const { return tree.size(); }
+        std::size_t capacity() const { return m_capacity; }
+        bool empty() const { return tree.size() == 0; }
+
+        // accesses smallest & largest elements of heap
+        const T& min() const {
+            if (tree.size() == 0) throw std::out_of_range("heap is empty, no element to access");
+            return tree[0];
+        }
+        const T& max() const {
+            if (tree.size() == 0) throw std::out_of_range("heap is empty, no element to access");
+            return tree[maxIndex()];
+        }
+
+        // inserts element into heap by creating new copy, returns false if element was rejected by a full heap
+        bool push(const T& val) { return insert(val); }
+
+        // inserts element into heap by "moving" its contents
+        bool push(T&& val) { return insert(std::move(val)); }
+
+        // removes smallest element from heap
+        void pop_min() {
+            if (tree.size() == 0) throw std::out_of_range("heap is empty, no element to remove");
+            erase(0);
+        }
+
+        // removes largest element from heap
+        void pop_max() {
+            if (tree.size() == 0) throw std::out_of_range("heap is empty, no element to remove");
+            erase(maxIndex());
+        }
+
+        // creates heap in O(n) time
+        void heapify() {
+            if (tree.size() <= 1) return;
+            std::size_t node = parent(tree.size() - 1);
+            while (true) {
+                siftDown(node);
+                if (node == 0) break;
+                node--;
+            }
+        }
+
+        // prints all elements in heap
+        void print() const {
+            for (const T& node : tree)
+                std::cout << node << ' ';
+            std::cout << '\n';
+        }
+};
@@ -0,0 +1,102 @@
+#include <thread>
+#include <chrono>
+#include <random>
+#include <numeric>
+#include <iomanip>
+#include "MultiQueue.h"
+
+typedef MultiQueue<int, std::greater<int>> MinMultiQueue;
+
+// average rank error of pops: # of smaller keys still in queue when a key is popped (0 for an exact min queue)
+double rankError(std::size_t num_queues_per_thread, std::size_t threads, int n) {
+    MinMultiQueue mq(threads, num_queues_per_thread);
+    std::vector<int> keys(n);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+    MinMultiQueue::Handle handle(mq, 1);
+    for (int k : keys) handle.push(k);
+    handle.flush();
+    // fenwick tree counts remaining keys smaller than popped key
+    std::vector<int> bit(n + 1, 0);
+    auto update = [&](int i, int d) { for (i++; i <= n; i += i & -i) bit[i] += d; };
+    auto query = [&](int i) { int s = 0; for (; i > 0; i -= i & -i) s += bit[i]; return s; };
+    for (int i = 0; i < n; i++) update(i, 1);
+    double total = 0;
+    int key, popped = 0;
+    while (handle.pop(key)) {
+        total += query(key);
+        update(key, -1);
+        popped++;
+    }
+    return total / popped;
+}
+
+// alternating push/pop operations per second across threads, queue is prefilled so pops rarely find it empty
+// makeHandle(queue, thread id) creates one thread's handle onto queue
+template <typename Q, typename MakeHandle>
+double throughput(Q& queue, MakeHandle makeHandle, int threads, int ops_per_thread) {
+    {
+        auto handle = makeHandle(queue, threads);
+        std::mt19937 rng(threads);
+        for (int i = 0; i < (1 << 16); i++) handle->push(rng() % 1000000);
+    }
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            auto handle = makeHandle(queue, t);
+            std::mt19937 rng(t);
+            int val;
+            for (int i = 0; i < ops_per_thread; i++) {
+                handle->push(rng() % 1000000);
+                handle->pop(val);
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    auto end = std::chrono::steady_clock::now();
+    return 2.0 * threads * ops_per_thread / std::chrono::duration<double>(end - start).count();
+}
+
+// baseline: single binary heap guarded by one mutex
+struct LockedHeap {
+    std::mutex lock;
+    BinaryHeap<int, std::greater<int>> heap;
+
+    struct Handle {
+        LockedHeap* lh;
+        void push(int v) { std::lock_guard<std::mutex> g(lh->lock); lh->heap.push(v); }
+        bool pop(int& out) {
+            std::lock_guard<std::mutex> g(lh->lock);
+            if (lh->heap.empty()) return false;
+            out = lh->heap.top(); lh->heap.pop();
+            return true;
+        }
+    };
+};
+
+// sample test case & benchmark for multiqueue
+int main() {
+    MinMultiQueue mq(1);
+    {
+        MinMultiQueue::Handle handle(mq, 1, 1);
+        for (int v : {5, 3, 8, 1, 9, 2}) handle.push(v);
+        int v;
+        std::cout << "Relaxed pop order: ";
+        while (handle.pop(v)) std::cout << v << ' ';
+        std::cout << '\n';
+    }
+
+    std::cout << '\n' << std::left << std::setw(10) << "threads" << std::setw(16) << "rank error"
+              << std::setw(20) << "locked heap ops/s" << std::setw(20) << "multiqueue ops/s" << '\n';
+    const int ops = 200000;
+    for (int p : {1, 2, 4, 8, 16, 32, 64}) {
+        double err = rankError(4, p, 200000);
+        LockedHeap lh;
+        double t1 = throughput(lh, [](LockedHeap& heap, int) { return std::make_unique<LockedHeap::Handle>(LockedHeap::Handle{&heap}); }, p, ops / p);
+        MinMultiQueue q(p);
+        double t2 = throughput(q, [](MinMultiQueue& queue, int t) { return std::make_unique<MinMultiQueue::Handle>(queue, t + 1); }, p, ops / p);
+        std::cout << std::setw(10) << p << std::setw(16) << err << std::setw(20) << t1 << std::setw(20) << t2 << '\n';
+    }
+    return 0;
+}
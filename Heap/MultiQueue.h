@@ -0,0 +1,119 @@
+#pragma once
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include "BinaryHeap.h"
+
+// multiqueue - relaxed concurrent priority queue built from c * p sequential binary heaps (max heap by default)
+//   - push inserts into a random heap, pop removes the better root of two randomly sampled heaps
+//   - each heap is guarded by its own lock, threads only try_lock so contention moves them to another heap
+//   - pops are not strictly ordered: popped element is close to, but not always, the best element (see rank error)
+// note: each thread must access queue through its own Handle, which owns the thread's rng & insertion buffer
+template <typename T, typename C = std::less<T>>
+class MultiQueue {
+    private:
+        // pads each heap to its own cache line to avoid false sharing between locks
+        struct alignas(64) Queue {
+            std::mutex lock;
+            BinaryHeap<T, C> heap;
+        };
+
+        std::unique_ptr<Queue[]> queues;
+        std::size_t num_queues;
+        std::atomic<std::size_t> m_size; // approximate number of elements in heaps (excludes thread-local buffers)
+
+    public:
+        // thread-local view of queue - buffers insertions & samples heaps using its own rng
+        class Handle {
+            private:
+                MultiQueue* mq;
+                std::vector<T> buffer; // insertions not yet visible to other threads
+                std::size_t buffer_size;
+                std::uint64_t state; // xorshift rng state
+
+                std::size_t randomQueue() {
+                    state ^= state << 13;
+                    state ^= state >> 7;
+                    state ^= state << 17;
+                    return state % mq->num_queues;
+                }
+
+                // pops from a locked heap if it holds an element with priority at least as high as other's root
+                bool popBetter(Queue& a, Queue& b, T& out) {
+                    C cmp;
+                    Queue* best = &a;
+                    if (a.heap.empty() || (!b.heap.empty() && cmp(a.heap.top(), b.heap.top())))
+                        best = &b;
+                    if (best->heap.empty()) return false;
+                    out = best->heap.top();
+                    best->heap.pop();
+                    mq->m_size--;
+                    return true;
+                }
+
+            public:
+                Handle(MultiQueue& p_mq, std::uint64_t seed, std::size_t p_buffer_size = 16)
+                    : mq(&p_mq), buffer_size(p_buffer_size), state(seed * 0x9E3779B97F4A7C15ull + 1) {
+                    buffer.reserve(buffer_size);
+                }
+                ~Handle() { flush(); }
+
+                // inserts element, buffered elements are published to a random heap in one batch
+                void push(const T& val) {
+                    buffer.push_back(val);
+                    if (buffer.size() >= buffer_size) flush();
+                }
+
+                // publishes buffered insertions to a random heap
+                void flush() {
+                    if (buffer.empty()) return;
+                    while (true) {
+                        Queue& q = mq->queues[randomQueue()];
+                        if (!q.lock.try_lock()) continue;
+                        q.heap.push_range(buffer.begin(), buffer.end());
+                        mq->m_size += buffer.size();
+                        q.lock.unlock();
+                        break;
+                    }
+                    buffer.clear();
+                }
+
+                // removes an element of (approximately) highest priority, returns false if queue appears empty
+                bool pop(T& out) {
+                    // samples two heaps, falls back to own buffer & full scan when sampled heaps are empty
+                    for (int attempt = 0; attempt < 4 && mq->m_size.load(std::memory_order_relaxed) > 0; attempt++) {
+                        Queue& a = mq->queues[randomQueue()];
+                        Queue& b = mq->queues[randomQueue()];
+                        if (&a == &b) {
+                            if (!a.lock.try_lock()) continue;
+                            bool found = popBetter(a, a, out);
+                            a.lock.unlock();
+                            if (found) return true;
+                            continue;
+                        }
+                        if (!a.lock.try_lock()) continue;
+                        if (!b.lock.try_lock()) { a.lock.unlock(); continue; }
+                        bool found = popBetter(a, b, out);
+                        b.lock.unlock();
+                        a.lock.unlock();
+                        if (found) return true;
+                    }
+                    flush();
+                    for (std::size_t i = 0; i < mq->num_queues; i++) {
+                        Queue& q = mq->queues[i];
+                        std::lock_guard<std::mutex> guard(q.lock);
+                        if (popBetter(q, q, out)) return true;
+                    }
+                    return false;
+                }
+        };
+
+        // c: heaps per thread (c >= 2 keeps contention low), p: number of threads
+        MultiQueue(std::size_t p, std::size_t c = 4) : queues(new Queue[c * p]), num_queues(c * p), m_size(0) {}
+
+        std::size_t size() const { return m_size.load(); }
+        bool empty() const { return m_size.load() == 0; }
+        std::size_t queueCount() const { return num_queues; }
+};
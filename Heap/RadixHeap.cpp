@@ -0,0 +1,88 @@
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include "RadixHeap.h"
+#include "BucketQueue.h"
+
+typedef std::vector<std::vector<std::pair<int, std::uint64_t>>> graph;
+
+// lazy-insertion dijkstra's with integer weights, works with any min queue storing {dist, vertex} pairs
+template <typename Q>
+std::vector<std::uint64_t> dijkstras(const graph& adj, int src, Q& min_heap) {
+    std::vector<std::uint64_t> dist(adj.size(), UINT64_MAX);
+    dist[src] = 0;
+    min_heap.push({0, src});
+    while (!min_heap.empty()) {
+        auto [d, curr] = min_heap.top(); min_heap.pop();
+        if (d != dist[curr]) continue;
+        for (auto& [next, weight] : adj[curr]) {
+            if (d + weight < dist[next]) {
+                dist[next] = d + weight;
+                min_heap.push({dist[next], next});
+            }
+        }
+    }
+    return dist;
+}
+
+// road-like graph: side x side grid with random weights in [1, max_weight]
+graph makeGrid(int side, int max_weight, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> w(1, max_weight);
+    graph adj(side * side);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) { adj[u].push_back({u + 1, w(rng)}); adj[u + 1].push_back({u, w(rng)}); }
+            if (r + 1 < side) { adj[u].push_back({u + side, w(rng)}); adj[u + side].push_back({u, w(rng)}); }
+        }
+    }
+    return adj;
+}
+
+template <typename Q>
+double timeQueue(const graph& adj, Q& queue, std::uint64_t& checksum) {
+    auto start = std::chrono::steady_clock::now();
+    auto dist = dijkstras(adj, 0, queue);
+    auto end = std::chrono::steady_clock::now();
+    checksum = 0;
+    for (auto d : dist) checksum += d;
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// sample test case & benchmark for monotone integer priority queues
+int main() {
+    RadixHeap<char> heap;
+    for (int key : {7, 3, 12, 3, 40, 9})
+        heap.push({key, 'a' + key % 26});
+    std::cout << "Radix heap pop order: ";
+    while (!heap.empty()) {
+        std::cout << heap.top().first << ' ';
+        heap.pop();
+    }
+    std::cout << '\n';
+
+    // compares queues on road-like grid graphs
+    typedef std::pair<std::uint64_t, int> pui;
+    std::cout << '\n' << std::left << std::setw(12) << "Grid" << std::setw(10) << "Max w" << std::setw(16) << "binary (ms)"
+              << std::setw(16) << "radix (ms)" << std::setw(16) << "bucket (ms)" << '\n';
+    for (int side : {256, 1024}) {
+        for (int max_weight : {10, 1000}) {
+            graph adj = makeGrid(side, max_weight, 42);
+            std::priority_queue<pui, std::vector<pui>, std::greater<pui>> binary;
+            RadixHeap<int> radix;
+            BucketQueue<int> bucket(max_weight);
+            std::uint64_t c1, c2, c3;
+            double t1 = timeQueue(adj, binary, c1);
+            double t2 = timeQueue(adj, radix, c2);
+            double t3 = timeQueue(adj, bucket, c3);
+            if (c1 != c2 || c1 != c3) std::cout << "distance mismatch!\n";
+            std::cout << std::setw(12) << (std::to_string(side) + "^2") << std::setw(10) << max_weight << std::setw(16) << t1
+                      << std::setw(16) << t2 << std::setw(16) << t3 << '\n';
+        }
+    }
+    return 0;
+}
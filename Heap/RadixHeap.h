@@ -0,0 +1,84 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+
+// radix heap - monotone min priority queue for non-negative integer keys (O(log C) amortized per operation)
+//   - elements are stored as {key, value} pairs, keys popped from heap never decrease
+//   - bucket i holds keys whose highest bit differing from the last popped key is bit i - 1 (bucket 0 = equal keys)
+//   - each element can only move to lower buckets, so it is redistributed at most log C times
+template <typename T, typename K = std::uint64_t>
+class RadixHeap {
+    public:
+        typedef std::pair<K, T> value_type;
+
+    private:
+        static const int num_buckets = sizeof(K) * 8 + 1;
+
+        mutable std::vector<value_type> buckets[num_buckets];
+        mutable K last; // last key removed from heap (lower bound of every key in heap)
+        std::size_t m_size;
+
+        // index of highest bit differing between key and last popped key
+        static int bucketIndex(K key, K last) {
+            if (key == last) return 0;
+            return sizeof(unsigned long long) * 8 - __builtin_clzll((unsigned long long) (key ^ last));
+        }
+
+        // refills bucket 0 by redistributing the first non-empty bucket around its min key
+        void pull() const {
+            if (!buckets[0].empty()) return;
+            int i = 1;
+            while (buckets[i].empty()) i++;
+            K mn = buckets[i][0].first;
+            for (const auto& node : buckets[i])
+                if (node.first < mn) mn = node.first;
+            last = mn;
+            for (auto& node : buckets[i])
+                buckets[bucketIndex(node.first, last)].push_back(std::move(node));
+            buckets[i].clear();
+        }
+
+    public:
+        RadixHeap() : last(0), m_size(0) {}
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        // accesses element with minimum key
+        const value_type& top() const {
+            if (m_size == 0) throw std::out_of_range("heap is empty, no element to access");
+            pull();
+            return buckets[0].back();
+        }
+        const value_type& front() const { return top(); }
+
+        // inserts element into heap, key must not be smaller than last popped key
+        void push(const value_type& val) {
+            if (val.first < last) throw std::invalid_argument("key is smaller than last popped key");
+            buckets[bucketIndex(val.first, last)].push_back(val);
+            m_size++;
+        }
+
+        void push(value_type&& val) {
+            if (val.first < last) throw std::invalid_argument("key is smaller than last popped key");
+            buckets[bucketIndex(val.first, last)].push_back(std::move(val));
+            m_size++;
+        }
+
+        // removes element with minimum key
+        void pop() {
+            if (m_size == 0) throw std::out_of_range("heap is empty, no element to remove");
+            pull();
+            buckets[0].pop_back();
+            m_size--;
+        }
+
+        // removes all elements and resets the monotone lower bound
+        void clear() {
+            for (auto& bucket : buckets) bucket.clear();
+            last = 0;
+            m_size = 0;
+        }
+};
@@ -0,0 +1,74 @@
+#pragma once
+#include <vector>
+#include <cstdlib>
+#include <cstddef>
+#include <utility>
+#include <functional>
+
+/* comparator based sorting routines for any element type, shared with other folders (e.g. filter kruskal on graph edges)
+//   - partition3: three way partition around a pivot, returns the block of elements equal to it
+//   - quicksort: quick_sort.cpp with three way partitions & an insertion sort cutoff for small ranges
+//   - same conventions as sort.h: ranges are inclusive [l, r]
+//   - header only & no `using namespace std`, so other folders can include it
+*/
+namespace generic {
+    // random index in [0, range), combines two rand() calls since RAND_MAX may be as small as 32767
+    inline std::size_t randomIndex(std::size_t range) {
+        unsigned long long r = (unsigned long long) rand() * ((unsigned long long) RAND_MAX + 1) + rand();
+        return r % range;
+    }
+
+    // insertion sort - iterative - insert next element into trailing sorted array each iteration
+    template <typename T, typename C = std::less<T>>
+    void insertionsort(std::vector<T>& v, std::ptrdiff_t l, std::ptrdiff_t r, C less = C()) {
+        for (std::ptrdiff_t i = l + 1; i <= r; i++) {
+            std::ptrdiff_t j = i;
+            while (j > l && less(v[j], v[j - 1])) {
+                std::swap(v[j], v[j - 1]);
+                j--;
+            }
+        }
+    }
+
+    /* three way partition (dutch national flag) around value of pivot
+    //   - returns {lt, gt}: [l, lt) less than, [lt, gt] equal to & (gt, r] greater than pivot value
+    //   - runs of equal elements end up in one block, so callers can skip them instead of recursing on them
+    */
+    template <typename T, typename C = std::less<T>>
+    std::pair<std::ptrdiff_t, std::ptrdiff_t> partition3(std::vector<T>& v, std::ptrdiff_t l, std::ptrdiff_t r, std::ptrdiff_t pivot, C less = C()) {
+        std::swap(v[l], v[pivot]);
+        std::ptrdiff_t lt = l, i = l + 1, gt = r;
+        while (i <= gt) {
+            if (less(v[i], v[lt])) std::swap(v[lt++], v[i++]);
+            else if (less(v[lt], v[i])) std::swap(v[i], v[gt--]);
+            else i++;
+        }
+        return {lt, gt};
+    }
+
+    /* quick sort - divide & conquer (top down) - partition subarrays based off random pivot
+    //   - ranges of at most cutoff elements are finished by insertion sort
+    //   - three way partitions, so runs of equal elements are placed once instead of degrading to O(n^2)
+    //   - recurses into the smaller side & loops on the larger one, so stack depth stays O(log n)
+    */
+    template <typename T, typename C = std::less<T>>
+    void quicksort(std::vector<T>& v, std::ptrdiff_t l, std::ptrdiff_t r, C less = C(), std::ptrdiff_t cutoff = 16) {
+        while (r - l + 1 > cutoff) {
+            std::ptrdiff_t pivot = l + (std::ptrdiff_t) randomIndex(r - l + 1);
+            auto [lt, gt] = partition3(v, l, r, pivot, less);
+            if (lt - l < r - gt) {
+                quicksort(v, l, lt - 1, less, cutoff);
+                l = gt + 1;
+            } else {
+                quicksort(v, gt + 1, r, less, cutoff);
+                r = lt - 1;
+            }
+        }
+        insertionsort(v, l, r, less);
+    }
+
+    template <typename T, typename C = std::less<T>>
+    void quicksort(std::vector<T>& v, C less = C()) {
+        quicksort(v, 0, (std::ptrdiff_t) v.size() - 1, less);
+    }
+}